@@ -0,0 +1,73 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Count every heap allocation made by the benchmark process
+namespace {
+std::atomic<size_t> allocationCount{0};
+}
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+int runAllocationBenchmark() {
+    constexpr size_t SOLVES_PER_SIZE = 100;
+    const size_t sizes[] = {5, 6, 8, 10, 12, 16, 20, 50, 100};
+
+    std::cout << "\n=== Allocation Benchmark ===\n\n";
+    std::cout << std::left
+              << std::setw(12) << "Board"
+              << std::setw(10) << "Solves"
+              << std::setw(16) << "Allocs/solve"
+              << std::setw(14) << "Median (μs)"
+              << "\n";
+    std::cout << std::string(52, '-') << "\n";
+
+    bool allZero = true;
+    for (size_t size : sizes) {
+        Board board(size, size);
+        Solver solver(board);
+
+        std::vector<double> times;
+        times.reserve(SOLVES_PER_SIZE);
+
+        // times is reserved up front, so only solve() can allocate inside the loop
+        size_t before = allocationCount.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < SOLVES_PER_SIZE; ++i) {
+            Timer timer;
+            solver.solve(0, 0, TourType::OPEN);
+            times.push_back(static_cast<double>(timer.elapsedMicroseconds()));
+        }
+        size_t allocations = allocationCount.load(std::memory_order_relaxed) - before;
+
+        auto timing = Statistics::compute(times);
+        double perSolve = static_cast<double>(allocations) / SOLVES_PER_SIZE;
+        allZero = allZero && allocations == 0;
+
+        std::cout << std::left << std::fixed << std::setprecision(2)
+                  << std::setw(12) << (std::to_string(size) + "x" + std::to_string(size))
+                  << std::setw(10) << SOLVES_PER_SIZE
+                  << std::setw(16) << perSolve
+                  << std::setw(14) << timing.median
+                  << "\n";
+    }
+
+    std::cout << "\n" << (allZero ? "PASS: no heap allocations during solve\n"
+                                  : "FAIL: solve allocated on the heap\n");
+    return allZero ? 0 : 1;
+}
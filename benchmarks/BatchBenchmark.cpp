@@ -0,0 +1,76 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "BatchRunner.h"
+#include "OutputBuffer.h"
+#include <random>
+#include <sstream>
+
+int runBatchBenchmark() {
+    const size_t jobCount = 20000;
+    const size_t sizes[] = {8, 8, 16, 20, 30, 50};
+
+    std::mt19937 random(42);
+    std::string input;
+    std::vector<BatchJob> jobs;
+    for (size_t i = 0; i < jobCount; ++i) {
+        const size_t size = sizes[random() % std::size(sizes)];
+        BatchJob job;
+        job.width = job.height = size;
+        job.startRow = static_cast<int>(random() % size);
+        job.startCol = static_cast<int>(random() % size);
+        jobs.push_back(job);
+        input += "size=" + std::to_string(size) + " start=" + std::to_string(job.startRow) + "," +
+                 std::to_string(job.startCol) + "\n";
+    }
+
+    std::cout << "\n=== Batch solving: " << jobCount << " open tours, sizes 8-50, random starts ===\n\n";
+    std::cout << std::left
+              << std::setw(34) << "Mode"
+              << std::setw(12) << "Time (ms)"
+              << std::setw(12) << "Jobs/s"
+              << std::setw(10) << "Boards"
+              << "Solved"
+              << "\n";
+    std::cout << std::string(76, '-') << "\n";
+
+    auto report = [](const char* mode, double ms, size_t boards, size_t solved) {
+        std::cout << std::left << std::fixed << std::setprecision(1)
+                  << std::setw(34) << mode
+                  << std::setw(12) << ms
+                  << std::setw(12) << std::setprecision(0) << (ms > 0.0 ? jobCount * 1000.0 / ms : 0.0)
+                  << std::setw(10) << boards
+                  << solved
+                  << "\n";
+    };
+
+    // One runner per job: a fresh Board and Solver every time, as with one process per job
+    std::ostringstream freshOut;
+    size_t freshSolved = 0;
+    Timer freshTimer;
+    {
+        OutputBuffer out(freshOut);
+        for (const auto& job : jobs) {
+            BatchRunner runner;
+            freshSolved += runner.process(job, out) ? 1 : 0;
+        }
+    }
+    const double freshMs = freshTimer.elapsedMilliseconds();
+    report("Fresh board per job", freshMs, jobCount, freshSolved);
+
+    // One runner for the whole stream, parsing the job lines too
+    std::istringstream in(input);
+    std::ostringstream batchOut;
+    std::ostringstream errors;
+    BatchRunner runner;
+    Timer batchTimer;
+    const size_t rejected = runner.run(in, batchOut, errors);
+    const double batchMs = batchTimer.elapsedMilliseconds();
+    report("BatchRunner (parse + reuse)", batchMs, runner.getBoardAllocations(), runner.getSolvedCount());
+
+    std::cout << "\nSpeedup: " << std::setprecision(2) << (batchMs > 0.0 ? freshMs / batchMs : 0.0) << "x"
+              << " (process startup, not measured here, adds about 1-2 ms per job)\n";
+
+    const bool ok = rejected == 0 && runner.getJobCount() == jobCount && runner.getSolvedCount() == freshSolved;
+    std::cout << (ok ? "PASS: same results with reused boards\n" : "FAIL: results differ\n");
+    return ok ? 0 : 1;
+}
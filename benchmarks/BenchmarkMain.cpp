@@ -0,0 +1,81 @@
+#include "Benchmarks.h"
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace {
+
+struct BenchmarkEntry {
+    const char* name;
+    const char* description;
+    int (*run)();
+};
+
+constexpr BenchmarkEntry BENCHMARKS[] = {
+    {"alloc", "Heap allocations per solve (asserts zero)", runAllocationBenchmark},
+    {"layout", "Move generation: bounds-checked vs padded sentinel layout, 8x8 and 100x100", runLayoutBenchmark},
+    {"fixed", "Dynamic vs compile-time specialized solver, all starts on 8x8, 10x10, 12x12", runFixedSizeBenchmark},
+    {"degree", "Degree map and dead-end test: scalar vs AVX2/word kernels, 100x100 and 1000x1000", runDegreeBenchmark},
+    {"engine", "Iterative vs recursive search engine, 8x8..200x200", runEngineBenchmark},
+    {"divide", "Divide-and-conquer tour construction, 100x100..1000x1000", runDivideAndConquerBenchmark},
+    {"portfolio", "Single solver vs raced tie-break strategies, closed 8x8..12x12", runPortfolioBenchmark},
+    {"parallel", "Work-stealing tree search scaling over thread counts", runParallelBenchmark},
+    {"count", "Tour counting (frontier DP) on 3xN..6x6, checked by enumeration", runCountingBenchmark},
+    {"sweep", "All-starts sweep, full vs one solve per symmetry orbit, 8x8..50x50", runSymmetryBenchmark},
+    {"cache", "Solution cache: cold solve vs memory and disk hits, 8x8..900x900", runCacheBenchmark},
+    {"format", "Binary .kt vs JSON export, mmap open, random access and decode, 100x100 and 1000x1000", runTourFileBenchmark},
+    {"export", "JSON/SVG/text export MB/s, buffered vs ostream, 100x100 and 1000x1000", runExportBenchmark},
+    {"png", "PNG export time and size, 8x8 to 1000x1000", runPngBenchmark},
+    {"batch", "Batch jobs/s, reused boards vs a fresh board per job", runBatchBenchmark},
+    {"pool", "Start-position sweep solves/s, fresh boards vs SolverPool threads, 50x50", runPoolBenchmark},
+    {"serve", "Unix socket server requests/s, plus a client that never reads", runServeBenchmark},
+    {"limits", "Solve limit overhead and stop latency, impossible-tour rejection", runLimitsBenchmark},
+    {"restart", "Closed-tour time tail, fixed tie-breaks vs Luby restarts, all starts 8x8..50x50 (~3 min)", runRestartBenchmark},
+};
+
+void printUsage() {
+    std::cout << "Usage: knights_tour_bench [--list] [NAME...]\n\n";
+    std::cout << "Runs the named benchmarks, or all of them if none are given.\n\n";
+    std::cout << "Benchmarks:\n";
+    for (const auto& entry : BENCHMARKS) {
+        std::cout << "  " << entry.name << std::string(12 - std::strlen(entry.name), ' ')
+                  << entry.description << "\n";
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int failures = 0;
+    bool ranAny = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help" || arg == "--list") {
+            printUsage();
+            return 0;
+        }
+
+        bool found = false;
+        for (const auto& entry : BENCHMARKS) {
+            if (arg == entry.name) {
+                found = true;
+                ranAny = true;
+                failures += entry.run() != 0;
+            }
+        }
+        if (!found) {
+            std::cerr << "Unknown benchmark: " << arg << "\n";
+            printUsage();
+            return 1;
+        }
+    }
+
+    if (!ranAny) {
+        for (const auto& entry : BENCHMARKS) {
+            failures += entry.run() != 0;
+        }
+    }
+
+    return failures == 0 ? 0 : 1;
+}
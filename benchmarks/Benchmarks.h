@@ -0,0 +1,129 @@
+#pragma once
+
+/**
+ * @brief Benchmarks run by the knights_tour_bench executable
+ *
+ * Each benchmark prints its own report and returns a process exit code
+ * (0 on success). Benchmarks that assert a property (e.g. zero allocations)
+ * return nonzero when the assertion fails.
+ */
+
+/**
+ * @brief Count heap allocations per solve after Board/Solver construction
+ * @return 0 if every solve performed zero allocations
+ */
+int runAllocationBenchmark();
+
+/**
+ * @brief Compare the iterative and recursive search engines
+ * @return 0 if both engines produced identical tours
+ */
+int runEngineBenchmark();
+
+/**
+ * @brief Time divide-and-conquer tour construction on large boards
+ * @return 0 if every constructed tour is a valid closed tour
+ */
+int runDivideAndConquerBenchmark();
+
+/**
+ * @brief Compare a single solver with a portfolio of raced strategies
+ * @return 0 if every portfolio tour is a valid closed tour
+ */
+int runPortfolioBenchmark();
+
+/**
+ * @brief Measure work-stealing parallel search speedup over thread counts
+ * @return 0 if every thread count produced the expected result
+ */
+int runParallelBenchmark();
+
+/**
+ * @brief Count tours with the frontier DP and cross-check by enumeration
+ * @return 0 if every count matches enumeration and published values
+ */
+int runCountingBenchmark();
+
+/**
+ * @brief Compare a full start-square sweep with the symmetry-reduced sweep
+ * @return 0 if both sweeps agree on every square and all derived tours are valid
+ */
+int runSymmetryBenchmark();
+
+/**
+ * @brief Compare bounds-checked move generation with the padded cell layout
+ * @return 0 if every method computes the same degrees
+ */
+int runLayoutBenchmark();
+
+/**
+ * @brief Compare the dynamic solver with the compile-time specialized sizes
+ * @return 0 if both find the same tours with the same backtrack counts
+ */
+int runFixedSizeBenchmark();
+
+/**
+ * @brief Compare the scalar and AVX2 degree-map kernels and dead-end tests
+ * @return 0 if every kernel computes the same result
+ */
+int runDegreeBenchmark();
+
+/**
+ * @brief Time cold solves against memory and disk cache hits
+ * @return 0 if every hit replays the tour of the cold solve
+ */
+int runCacheBenchmark();
+
+/**
+ * @brief Compare .kt and JSON export size and speed, and time .kt reads
+ * @return 0 if every .kt file reads back the exported tour
+ */
+int runTourFileBenchmark();
+
+/**
+ * @brief Measure exporter throughput against ostream-formatted output
+ * @return 0 if every format produces byte-identical files
+ */
+int runExportBenchmark();
+
+/**
+ * @brief Time PNG export (rasterizer and deflate) up to a 1000x1000 tour
+ * @return 0 if every PNG is well-formed
+ */
+int runPngBenchmark();
+
+/**
+ * @brief Measure batch throughput with reused boards against a fresh board per job
+ * @return 0 if both find the same number of tours
+ */
+int runBatchBenchmark();
+
+/**
+ * @brief Sweep every start of a 50x50 board with fresh boards, one workspace and a SolverPool
+ * @return 0 if every mode solves the same number of starts
+ */
+int runPoolBenchmark();
+
+/**
+ * @brief Measure Unix socket server requests/s, one at a time and pipelined
+ *
+ * Also floods the server from a client that does not read its replies.
+ *
+ * @return 0 if every request is answered with a tour and the flood does not grow the server
+ */
+int runServeBenchmark();
+
+/**
+ * @brief Measure the cost of solve limits, how promptly each one stops a search,
+ *        and the time to reject tours that cannot exist
+ * @return 0 if every limit stops the search with its status, in time, and
+ *         every impossible tour is rejected without searching
+ */
+int runLimitsBenchmark();
+
+/**
+ * @brief Compare closed-tour solve times from every start with and without Luby restarts
+ * @return 0 if restarts solve at least as many starts, never lengthen the p99 or max,
+ *         shorten every p99 they measure within the time limit, and every tour is valid
+ */
+int runRestartBenchmark();
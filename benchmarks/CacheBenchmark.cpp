@@ -0,0 +1,89 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "SolutionCache.h"
+#include <algorithm>
+#include <filesystem>
+
+namespace {
+
+bool samePath(const std::vector<Move>& a, const std::vector<Move>& b) {
+    return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+                      [](const Move& x, const Move& y) { return x.row == y.row && x.col == y.col; });
+}
+
+}  // namespace
+
+int runCacheBenchmark() {
+    const size_t sizes[] = {8, 100, 300, 900};
+    const std::filesystem::path directory =
+        std::filesystem::temp_directory_path() / "knights_tour_cache_bench";
+    std::filesystem::remove_all(directory);
+
+    std::cout << "\n=== Solution Cache (open tour from 0,0) ===\n\n";
+    std::cout << std::left
+              << std::setw(12) << "Board"
+              << std::setw(14) << "Solve (ms)"
+              << std::setw(16) << "Memory (us)"
+              << std::setw(14) << "Disk (us)"
+              << std::setw(16) << "Install (us)"
+              << std::setw(12) << "File (KB)"
+              << "Check"
+              << "\n";
+    std::cout << std::string(90, '-') << "\n";
+
+    bool allMatch = true;
+    for (size_t size : sizes) {
+        Board board(size, size);
+        Solver solver(board);
+        SolutionCache cache(SolutionCache::DEFAULT_CAPACITY, directory.string());
+        const SolutionKey key{size, size, 0, 0, TourType::OPEN};
+
+        // Cold: search and store (memory and disk)
+        Timer solveTimer;
+        bool solved = cache.solve(solver, size, size, 0, 0, TourType::OPEN);
+        double solveMs = solveTimer.elapsedMilliseconds();
+        const std::vector<Move> expected = solver.getPath();
+        const size_t expectedBacktracks = solver.getBacktrackCount();
+
+        // Memory hit: lookup only
+        Timer memoryTimer;
+        auto fromMemory = cache.find(key);
+        double memoryUs = static_cast<double>(memoryTimer.elapsedMicroseconds());
+
+        // Disk hit: a fresh cache maps and decodes the file
+        SolutionCache coldCache(SolutionCache::DEFAULT_CAPACITY, directory.string());
+        Timer diskTimer;
+        auto fromDisk = coldCache.find(key);
+        double diskUs = static_cast<double>(diskTimer.elapsedMicroseconds());
+
+        // Replaying a hit into a solver validates and numbers the board
+        bool hit = false;
+        Timer installTimer;
+        bool replayed = cache.solve(solver, size, size, 0, 0, TourType::OPEN, &hit);
+        double installUs = static_cast<double>(installTimer.elapsedMicroseconds());
+
+        bool match = solved && replayed && hit && fromMemory && fromDisk &&
+                     samePath(fromMemory->path, expected) && samePath(fromDisk->path, expected) &&
+                     samePath(solver.getPath(), expected) &&
+                     fromDisk->backtracks == expectedBacktracks &&
+                     solver.getBacktrackCount() == expectedBacktracks;
+        allMatch = allMatch && match;
+
+        double fileKb = static_cast<double>(std::filesystem::file_size(cache.filePath(key))) / 1024.0;
+        std::cout << std::left << std::fixed << std::setprecision(2)
+                  << std::setw(12) << (std::to_string(size) + "x" + std::to_string(size))
+                  << std::setw(14) << solveMs
+                  << std::setw(16) << memoryUs
+                  << std::setw(14) << diskUs
+                  << std::setw(16) << installUs
+                  << std::setw(12) << fileKb
+                  << (match ? "ok" : "MISMATCH")
+                  << "\n";
+    }
+
+    std::filesystem::remove_all(directory);
+    std::cout << "\nMemory and disk columns are lookups; Install is a full cached solve()\n"
+              << "(lookup, path validation and board numbering).\n";
+    std::cout << (allMatch ? "PASS: hits replay the solved tours\n" : "FAIL: cached tours differ\n");
+    return allMatch ? 0 : 1;
+}
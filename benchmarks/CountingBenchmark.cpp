@@ -0,0 +1,96 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "TourCounter.h"
+
+namespace {
+
+struct CountCase {
+    size_t width;
+    size_t height;
+    TourType type;
+    uint64_t expected;      // Published count (0 = not checked)
+    bool crossCheck;        // Also enumerate and compare
+};
+
+const char* typeName(TourType type) {
+    return type == TourType::OPEN ? "open" : "closed";
+}
+
+// Directed tours from enumeration, as count() counts them
+uint64_t enumerateAll(TourCounter& counter, size_t width, size_t height, TourType type) {
+    if (type == TourType::CLOSED) {
+        return counter.enumerate(0, 0, type) / 2;
+    }
+    uint64_t total = 0;
+    for (int row = 0; row < static_cast<int>(height); ++row) {
+        for (int col = 0; col < static_cast<int>(width); ++col) {
+            total += counter.enumerate(row, col, type);
+        }
+    }
+    return total / 2;
+}
+
+}  // namespace
+
+int runCountingBenchmark() {
+    const CountCase cases[] = {
+        {3, 10, TourType::CLOSED, 16, true},
+        {3, 12, TourType::CLOSED, 176, true},
+        {3, 20, TourType::OPEN, 0, false},
+        {3, 40, TourType::CLOSED, 0, false},
+        {4, 5, TourType::OPEN, 82, true},
+        {4, 8, TourType::OPEN, 31088, false},
+        {4, 16, TourType::OPEN, 0, false},
+        {5, 5, TourType::OPEN, 864, true},
+        {5, 6, TourType::CLOSED, 8, true},
+        {5, 8, TourType::CLOSED, 44202, false},
+        {6, 6, TourType::CLOSED, 9862, false},
+    };
+
+    std::cout << "\n=== Tour Counting Benchmark (frontier DP vs enumeration) ===\n\n";
+    std::cout << std::left
+              << std::setw(10) << "Board"
+              << std::setw(8) << "Type"
+              << std::setw(22) << "Tours"
+              << std::setw(12) << "DP (ms)"
+              << std::setw(12) << "States"
+              << std::setw(14) << "Enum (ms)"
+              << "Check"
+              << "\n";
+    std::cout << std::string(84, '-') << "\n";
+
+    bool allMatch = true;
+    for (const auto& c : cases) {
+        Board board(c.width, c.height);
+        TourCounter counter(board);
+
+        Timer timer;
+        uint64_t tours = counter.count(c.type);
+        double countMs = timer.elapsedMilliseconds();
+
+        bool match = c.expected == 0 || tours == c.expected;
+        std::string enumTime = "-";
+        if (c.crossCheck) {
+            Timer enumTimer;
+            match = match && enumerateAll(counter, c.width, c.height, c.type) == tours;
+            std::ostringstream text;
+            text << std::fixed << std::setprecision(2) << enumTimer.elapsedMilliseconds();
+            enumTime = text.str();
+        }
+        allMatch = allMatch && match;
+
+        std::cout << std::left << std::fixed << std::setprecision(2)
+                  << std::setw(10) << (std::to_string(c.width) + "x" + std::to_string(c.height))
+                  << std::setw(8) << typeName(c.type)
+                  << std::setw(22) << tours
+                  << std::setw(12) << countMs
+                  << std::setw(12) << counter.getPeakStateCount()
+                  << std::setw(14) << enumTime
+                  << (match ? "ok" : "MISMATCH")
+                  << "\n";
+    }
+
+    std::cout << "\nTours count a path and its reverse once; States is the peak frontier size.\n";
+    std::cout << (allMatch ? "PASS: counts match enumeration and published values\n" : "FAIL: count mismatch\n");
+    return allMatch ? 0 : 1;
+}
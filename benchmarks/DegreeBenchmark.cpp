@@ -0,0 +1,131 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "DegreeKernels.h"
+#include <algorithm>
+
+namespace {
+
+/**
+ * @brief Best time of a few runs of fn, in microseconds
+ */
+template<typename Fn>
+double bestMicroseconds(size_t repeats, Fn fn) {
+    double best = 0.0;
+    for (size_t attempt = 0; attempt < 5; ++attempt) {
+        Timer timer;
+        for (size_t i = 0; i < repeats; ++i) {
+            fn();
+        }
+        double us = static_cast<double>(timer.elapsedMicroseconds()) / static_cast<double>(repeats);
+        best = attempt == 0 ? us : std::min(best, us);
+    }
+    return best;
+}
+
+// Padded visited bitset with the border set and every third board square visited
+std::vector<uint64_t> makeVisited(const Board& board) {
+    std::vector<uint64_t> visited(DegreeKernels::bitsetWords(board.cellCount()), 0);
+    size_t index = 0;
+    for (size_t cell = 0; cell < board.cellCount(); ++cell) {
+        const Move square = board.cellToMove(cell);
+        bool onBoard = board.isValid(square.row, square.col);
+        if (!onBoard || index++ % 3 == 0) {
+            visited[cell >> 6] |= uint64_t{1} << (cell & 63);
+        }
+    }
+    return visited;
+}
+
+// Dead-end test as the solver did it before: visited lookup, then degree
+bool anyNeighborAtOneScalar(const std::vector<uint64_t>& visited, const uint8_t* degree, size_t cell,
+                            const std::array<ptrdiff_t, 8>& offsets) {
+    for (ptrdiff_t offset : offsets) {
+        const size_t neighbor = cell + offset;
+        if (!((visited[neighbor >> 6] >> (neighbor & 63)) & 1) && degree[neighbor] == 1) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+int runDegreeBenchmark() {
+    const bool haveAvx2 = DegreeKernels::activeIsa() == DegreeKernels::Isa::AVX2;
+
+    std::cout << "\n=== Degree Map Kernels (1/3 of squares visited) ===\n\n";
+    std::cout << "Runtime kernel: " << (haveAvx2 ? "AVX2" : "scalar (no AVX2 on this CPU)") << "\n\n";
+    std::cout << std::left
+              << std::setw(12) << "Board"
+              << std::setw(28) << "Kernel"
+              << std::setw(14) << "Time (us)"
+              << "vs scalar"
+              << "\n";
+    std::cout << std::string(64, '-') << "\n";
+
+    bool consistent = true;
+    const size_t sizes[] = {100, 1000};
+    for (size_t size : sizes) {
+        Board board(size, size);
+        const std::vector<uint64_t> visited = makeVisited(board);
+        const size_t repeats = size >= 1000 ? 10 : 1000;
+        const std::string label = std::to_string(size) + "x" + std::to_string(size);
+
+        std::vector<uint8_t> scalar;
+        std::vector<uint8_t> fast;
+        double scalarUs = bestMicroseconds(repeats, [&] {
+            DegreeKernels::computeDegreeMap(visited, size, size, scalar, DegreeKernels::Isa::SCALAR);
+        });
+        double fastUs = bestMicroseconds(repeats, [&] {
+            DegreeKernels::computeDegreeMap(visited, size, size, fast);
+        });
+        consistent = consistent && scalar == fast;
+
+        // Dead-end test over every unvisited square
+        const auto& offsets = board.knightOffsets();
+        size_t loopHits = 0;
+        size_t wordHits = 0;
+        double loopUs = bestMicroseconds(repeats, [&] {
+            loopHits = 0;
+            for (size_t row = 0; row < size; ++row) {
+                for (size_t col = 0; col < size; ++col) {
+                    loopHits += anyNeighborAtOneScalar(visited, fast.data(),
+                        board.cellIndex(static_cast<int>(row), static_cast<int>(col)), offsets);
+                }
+            }
+        });
+        double wordUs = bestMicroseconds(repeats, [&] {
+            wordHits = 0;
+            for (size_t row = 0; row < size; ++row) {
+                for (size_t col = 0; col < size; ++col) {
+                    wordHits += DegreeKernels::anyNeighborAtOne(fast.data(),
+                        board.cellIndex(static_cast<int>(row), static_cast<int>(col)), offsets);
+                }
+            }
+        });
+        consistent = consistent && loopHits == wordHits;
+
+        struct Row {
+            const char* kernel;
+            double us;
+            double baseline;
+        };
+        const Row rows[] = {
+            {"degree map, scalar", scalarUs, scalarUs},
+            {haveAvx2 ? "degree map, AVX2" : "degree map, runtime", fastUs, scalarUs},
+            {"dead-end test, loop", loopUs, loopUs},
+            {"dead-end test, 8 bytes/word", wordUs, loopUs},
+        };
+        for (const auto& row : rows) {
+            std::cout << std::left << std::fixed << std::setprecision(2)
+                      << std::setw(12) << label
+                      << std::setw(28) << row.kernel
+                      << std::setw(14) << row.us
+                      << (row.us > 0.0 ? row.baseline / row.us : 0.0) << "x"
+                      << "\n";
+        }
+    }
+
+    std::cout << "\n" << (consistent ? "PASS: kernels agree\n" : "FAIL: kernels disagree\n");
+    return consistent ? 0 : 1;
+}
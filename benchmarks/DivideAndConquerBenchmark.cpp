@@ -0,0 +1,49 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "DivideAndConquerSolver.h"
+
+int runDivideAndConquerBenchmark() {
+    constexpr size_t RUNS = 10;
+    const size_t sizes[] = {100, 250, 500, 750, 1000};
+
+    std::cout << "\n=== Divide-and-Conquer Benchmark (closed tour from 0,0) ===\n\n";
+    std::cout << std::left
+              << std::setw(14) << "Board"
+              << std::setw(12) << "Squares"
+              << std::setw(14) << "Median (ms)"
+              << std::setw(14) << "Min (ms)"
+              << "Valid"
+              << "\n";
+    std::cout << std::string(60, '-') << "\n";
+
+    bool allValid = true;
+    for (size_t size : sizes) {
+        Board board(size, size);
+        DivideAndConquerSolver builder(board);
+
+        std::vector<double> times;
+        times.reserve(RUNS);
+        bool built = true;
+        for (size_t i = 0; i < RUNS; ++i) {
+            Timer timer;
+            built = builder.solve(0, 0, TourType::CLOSED) && built;
+            times.push_back(timer.elapsedMilliseconds());
+        }
+
+        Solver solver(board);
+        bool valid = built && solver.setSolution(builder.getPath(), TourType::CLOSED);
+        allValid = allValid && valid;
+
+        auto timing = Statistics::compute(times);
+        std::cout << std::left << std::fixed << std::setprecision(2)
+                  << std::setw(14) << (std::to_string(size) + "x" + std::to_string(size))
+                  << std::setw(12) << board.size()
+                  << std::setw(14) << timing.median
+                  << std::setw(14) << timing.min
+                  << (valid ? "yes" : "NO")
+                  << "\n";
+    }
+
+    std::cout << "\n" << (allValid ? "PASS: all tours valid\n" : "FAIL: invalid tour\n");
+    return allValid ? 0 : 1;
+}
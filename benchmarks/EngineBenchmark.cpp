@@ -0,0 +1,80 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+
+namespace {
+
+struct EngineTiming {
+    Statistics timing;
+    bool solved;
+    size_t backtracks;
+    std::vector<Move> path;
+};
+
+EngineTiming timeEngine(size_t size, SearchEngine engine, size_t runs) {
+    Board board(size, size);
+    Solver solver(board);
+    solver.setSearchEngine(engine);
+
+    std::vector<double> times;
+    times.reserve(runs);
+    bool solved = false;
+    for (size_t i = 0; i < runs; ++i) {
+        Timer timer;
+        solved = solver.solve(0, 0, TourType::OPEN);
+        times.push_back(static_cast<double>(timer.elapsedMicroseconds()));
+    }
+    return {Statistics::compute(times), solved, solver.getBacktrackCount(), solver.getPath()};
+}
+
+} // namespace
+
+int runEngineBenchmark() {
+    const size_t sizes[] = {8, 16, 32, 50, 100, 200};
+
+    std::cout << "\n=== Search Engine Benchmark (open tour from 0,0) ===\n\n";
+    std::cout << std::left
+              << std::setw(12) << "Board"
+              << std::setw(18) << "Recursive (μs)"
+              << std::setw(18) << "Iterative (μs)"
+              << std::setw(10) << "Speedup"
+              << std::setw(12) << "Backtracks"
+              << "Same tour"
+              << "\n";
+    std::cout << std::string(80, '-') << "\n";
+
+    bool allMatch = true;
+    for (size_t size : sizes) {
+        size_t runs = size <= 50 ? 200 : 20;
+        auto recursive = timeEngine(size, SearchEngine::RECURSIVE, runs);
+        auto iterative = timeEngine(size, SearchEngine::ITERATIVE, runs);
+
+        bool sameTour = recursive.solved == iterative.solved &&
+                        recursive.backtracks == iterative.backtracks &&
+                        std::equal(recursive.path.begin(), recursive.path.end(),
+                                   iterative.path.begin(), iterative.path.end(),
+                                   [](const Move& a, const Move& b) { return a.row == b.row && a.col == b.col; });
+        allMatch = allMatch && sameTour;
+
+        double speedup = iterative.timing.median > 0.0 ? recursive.timing.median / iterative.timing.median : 0.0;
+        std::cout << std::left << std::fixed << std::setprecision(2)
+                  << std::setw(12) << (std::to_string(size) + "x" + std::to_string(size))
+                  << std::setw(18) << recursive.timing.median
+                  << std::setw(18) << iterative.timing.median
+                  << std::setw(10) << speedup
+                  << std::setw(12) << iterative.backtracks
+                  << (sameTour ? "yes" : "NO")
+                  << "\n";
+    }
+
+    // Only the iterative engine can go this deep (810,000 moves) without
+    // overflowing the stack
+    auto large = timeEngine(900, SearchEngine::ITERATIVE, 1);
+    std::cout << "\n900x900 (iterative only): "
+              << (large.solved ? "solved" : "not solved") << " in "
+              << large.timing.median / 1000.0 << " ms, "
+              << large.backtracks << " backtracks\n";
+
+    std::cout << "\n" << (allMatch ? "PASS: engines produced identical tours\n"
+                                   : "FAIL: engines diverged\n");
+    return allMatch ? 0 : 1;
+}
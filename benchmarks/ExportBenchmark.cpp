@@ -0,0 +1,248 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "DivideAndConquerSolver.h"
+#include "Exporter.h"
+#include <filesystem>
+#include <fstream>
+
+namespace {
+
+// The exporters as they were before OutputBuffer: per-field ostream formatting
+
+void legacyJSON(const Solver& solver, const Board& board, std::ofstream& file) {
+    const auto& path = solver.getPath();
+    auto stats = solver.getPathStatistics();
+    file << "{\n" << "  \"board\": {\n"
+         << "    \"width\": " << board.width() << ",\n"
+         << "    \"height\": " << board.height() << "\n" << "  },\n"
+         << "  \"solution\": {\n"
+         << "    \"moves\": " << path.size() << ",\n"
+         << "    \"backtracks\": " << solver.getBacktrackCount() << ",\n"
+         << "    \"path\": [\n";
+    for (size_t i = 0; i < path.size(); ++i) {
+        file << "      {\"row\": " << path[i].row << ", \"col\": " << path[i].col << "}";
+        if (i < path.size() - 1) file << ",";
+        file << "\n";
+    }
+    file << "    ],\n" << "    \"statistics\": {\n"
+         << "      \"cornerVisits\": " << stats.cornerVisits << ",\n"
+         << "      \"edgeVisits\": " << stats.edgeVisits << ",\n"
+         << "      \"centerVisits\": " << stats.centerVisits << ",\n"
+         << "      \"avgDistanceFromCenter\": " << stats.averageDistanceFromCenter << "\n"
+         << "    }\n" << "  }\n" << "}\n";
+}
+
+void legacySVG(const Solver& solver, const Board& board, std::ofstream& file) {
+    const auto& path = solver.getPath();
+    const int cellSize = 60;
+    const int padding = 40;
+    const int width = board.width() * cellSize + 2 * padding;
+    const int height = board.height() * cellSize + 2 * padding;
+
+    file << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    file << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" << width << "\" height=\"" << height << "\">\n";
+    file << "  <text x=\"" << width/2 << "\" y=\"25\" text-anchor=\"middle\" "
+         << "font-family=\"Arial\" font-size=\"18\" font-weight=\"bold\">"
+         << "Knight's Tour Solution (" << board.width() << "×" << board.height() << ")" << "</text>\n\n";
+    file << "  <!-- Chessboard -->\n";
+    for (int row = 0; row < static_cast<int>(board.height()); ++row) {
+        for (int col = 0; col < static_cast<int>(board.width()); ++col) {
+            int x = padding + col * cellSize;
+            int y = padding + row * cellSize;
+            bool isLight = (row + col) % 2 == 0;
+            file << "  <rect x=\"" << x << "\" y=\"" << y
+                 << "\" width=\"" << cellSize << "\" height=\"" << cellSize
+                 << "\" fill=\"" << (isLight ? "#f0d9b5" : "#b58863") << "\"/>\n";
+        }
+    }
+    file << "\n  <!-- Path lines -->\n";
+    file << "  <g stroke=\"#2196F3\" stroke-width=\"3\" stroke-opacity=\"0.6\" "
+         << "fill=\"none\" stroke-linecap=\"round\">\n";
+    for (size_t i = 0; i < path.size() - 1; ++i) {
+        file << "    <line x1=\"" << padding + path[i].col * cellSize + cellSize / 2
+             << "\" y1=\"" << padding + path[i].row * cellSize + cellSize / 2
+             << "\" x2=\"" << padding + path[i + 1].col * cellSize + cellSize / 2
+             << "\" y2=\"" << padding + path[i + 1].row * cellSize + cellSize / 2 << "\"/>\n";
+    }
+    file << "  </g>\n";
+    file << "\n  <!-- Move numbers -->\n";
+    for (size_t i = 0; i < path.size(); ++i) {
+        int x = padding + path[i].col * cellSize + cellSize / 2;
+        int y = padding + path[i].row * cellSize + cellSize / 2;
+        std::string fillColor = (i == 0) ? "#4CAF50" : (i == path.size() - 1) ? "#F44336" : "#FFF";
+        file << "  <circle cx=\"" << x << "\" cy=\"" << y << "\" r=\"18\" "
+             << "fill=\"" << fillColor << "\" stroke=\"#333\" stroke-width=\"2\"/>\n";
+        file << "  <text x=\"" << x << "\" y=\"" << (y + 5)
+             << "\" text-anchor=\"middle\" font-family=\"Arial\" "
+             << "font-size=\"14\" font-weight=\"bold\" fill=\"#333\">" << (i + 1) << "</text>\n";
+    }
+    file << "\n  <!-- Legend -->\n";
+    int legendY = height - 15;
+    file << "  <circle cx=\"20\" cy=\"" << legendY << "\" r=\"8\" fill=\"#4CAF50\"/>\n";
+    file << "  <text x=\"35\" y=\"" << (legendY + 4) << "\" font-family=\"Arial\" font-size=\"12\">Start</text>\n";
+    file << "  <circle cx=\"90\" cy=\"" << legendY << "\" r=\"8\" fill=\"#F44336\"/>\n";
+    file << "  <text x=\"105\" y=\"" << (legendY + 4) << "\" font-family=\"Arial\" font-size=\"12\">End</text>\n";
+    file << "</svg>\n";
+}
+
+void legacyText(const Solver& solver, const Board& board, std::ofstream& file) {
+    const auto& path = solver.getPath();
+    auto stats = solver.getPathStatistics();
+    file << "KNIGHT'S TOUR SOLUTION\n" << "======================\n\n"
+         << "Board Size: " << board.width() << " × " << board.height() << "\n"
+         << "Total Moves: " << path.size() << "\n"
+         << "Backtracks: " << solver.getBacktrackCount() << "\n\n"
+         << "STATISTICS\n" << "----------\n"
+         << "Corner Visits: " << stats.cornerVisits << "\n"
+         << "Edge Visits: " << stats.edgeVisits << "\n"
+         << "Center Visits: " << stats.centerVisits << "\n"
+         << "Avg Distance from Center: " << std::fixed << std::setprecision(2)
+         << stats.averageDistanceFromCenter << "\n\n"
+         << "MOVE SEQUENCE\n" << "-------------\n";
+    for (size_t i = 0; i < path.size(); ++i) {
+        file << "Move " << std::setw(3) << (i + 1) << ": ("
+             << std::setw(2) << path[i].row << ", " << std::setw(2) << path[i].col << ")\n";
+    }
+    file << "\nBOARD VISUALIZATION\n" << "-------------------\n";
+    std::vector<std::vector<int>> boardGrid(board.height(), std::vector<int>(board.width(), 0));
+    for (size_t i = 0; i < path.size(); ++i) {
+        boardGrid[path[i].row][path[i].col] = i + 1;
+    }
+    for (size_t row = 0; row < board.height(); ++row) {
+        for (size_t col = 0; col < board.width(); ++col) {
+            file << std::setw(4) << boardGrid[row][col];
+        }
+        file << "\n";
+    }
+}
+
+bool sameContents(const std::string& a, const std::string& b) {
+    std::ifstream first(a, std::ios::binary);
+    std::ifstream second(b, std::ios::binary);
+    std::vector<char> chunkA(1 << 20);
+    std::vector<char> chunkB(1 << 20);
+    while (first && second) {
+        first.read(chunkA.data(), static_cast<std::streamsize>(chunkA.size()));
+        second.read(chunkB.data(), static_cast<std::streamsize>(chunkB.size()));
+        if (first.gcount() != second.gcount() ||
+            !std::equal(chunkA.begin(), chunkA.begin() + first.gcount(), chunkB.begin())) {
+            return false;
+        }
+    }
+    return !first && !second;
+}
+
+}  // namespace
+
+int runExportBenchmark() {
+    struct Format {
+        const char* name;
+        bool (*exporter)(const Solver&, const Board&, const std::string&);
+        void (*legacy)(const Solver&, const Board&, std::ofstream&);
+    };
+    const Format formats[] = {
+        {"JSON", Exporter::exportToJSON, legacyJSON},
+        {"SVG", Exporter::exportToSVG, legacySVG},
+        {"Text", Exporter::exportToText, legacyText},
+    };
+    const size_t sizes[] = {100, 1000};
+    const std::filesystem::path directory = std::filesystem::temp_directory_path();
+    const std::string newFile = (directory / "knights_tour_export_bench.new").string();
+    const std::string oldFile = (directory / "knights_tour_export_bench.old").string();
+
+    std::cout << "\n=== Exporters: buffered to_chars vs ostream formatting (closed tours) ===\n\n";
+    std::cout << std::left
+              << std::setw(11) << "Board"
+              << std::setw(8) << "Format"
+              << std::setw(12) << "Size (MB)"
+              << std::setw(15) << "ostream MB/s"
+              << std::setw(15) << "buffered MB/s"
+              << std::setw(10) << "Speedup"
+              << "Same bytes"
+              << "\n";
+    std::cout << std::string(81, '-') << "\n";
+
+    struct DetailRow {
+        size_t size;
+        double fullMegabytes;
+        double megabytes;
+        double milliseconds;
+    };
+    std::vector<DetailRow> detailRows;
+
+    bool allSame = true;
+    for (size_t size : sizes) {
+        Board board(size, size);
+        Solver solver(board);
+        DivideAndConquerSolver builder(board);
+        if (!builder.solve(0, 0, TourType::CLOSED) || !solver.setSolution(builder.getPath(), TourType::CLOSED)) {
+            std::cout << size << "x" << size << ": no tour\n";
+            allSame = false;
+            continue;
+        }
+
+        double fullMegabytes = 0.0;
+        for (const auto& format : formats) {
+            Timer legacyTimer;
+            {
+                std::ofstream file(oldFile);
+                format.legacy(solver, board, file);
+            }
+            double legacyMs = legacyTimer.elapsedMilliseconds();
+
+            Timer bufferedTimer;
+            bool written = format.exporter(solver, board, newFile);
+            double bufferedMs = bufferedTimer.elapsedMilliseconds();
+
+            const double megabytes = static_cast<double>(std::filesystem::file_size(newFile)) / (1024.0 * 1024.0);
+            const bool same = written && sameContents(oldFile, newFile);
+            if (format.exporter == Exporter::exportToSVG) {
+                fullMegabytes = megabytes;
+            }
+            allSame = allSame && same;
+
+            std::cout << std::left << std::fixed << std::setprecision(2)
+                      << std::setw(11) << (std::to_string(size) + "x" + std::to_string(size))
+                      << std::setw(8) << format.name
+                      << std::setw(12) << megabytes
+                      << std::setw(15) << (legacyMs > 0.0 ? megabytes * 1000.0 / legacyMs : 0.0)
+                      << std::setw(15) << (bufferedMs > 0.0 ? megabytes * 1000.0 / bufferedMs : 0.0)
+                      << std::setw(10) << (bufferedMs > 0.0 ? legacyMs / bufferedMs : 0.0)
+                      << (same ? "yes" : "NO")
+                      << "\n";
+        }
+
+        Timer detailTimer;
+        if (Exporter::exportToSVGLevelOfDetail(solver, board, newFile)) {
+            const double milliseconds = detailTimer.elapsedMilliseconds();
+            detailRows.push_back({size, fullMegabytes,
+                                  static_cast<double>(std::filesystem::file_size(newFile)) / (1024.0 * 1024.0),
+                                  milliseconds});
+        }
+    }
+
+    std::cout << "\nLevel-of-detail SVG (pattern board, one relative path, no labels):\n\n";
+    std::cout << std::left
+              << std::setw(11) << "Board"
+              << std::setw(15) << "Full SVG (MB)"
+              << std::setw(14) << "LOD SVG (MB)"
+              << std::setw(12) << "Percent"
+              << "Time (ms)"
+              << "\n";
+    std::cout << std::string(61, '-') << "\n";
+    for (const auto& row : detailRows) {
+        std::cout << std::left << std::fixed << std::setprecision(2)
+                  << std::setw(11) << (std::to_string(row.size) + "x" + std::to_string(row.size))
+                  << std::setw(15) << row.fullMegabytes
+                  << std::setw(14) << row.megabytes
+                  << std::setw(12) << row.megabytes * 100.0 / row.fullMegabytes
+                  << row.milliseconds
+                  << "\n";
+    }
+
+    std::filesystem::remove(newFile);
+    std::filesystem::remove(oldFile);
+    std::cout << "\nTimes include opening the file and computing path statistics.\n";
+    std::cout << (allSame ? "PASS: output is byte-identical\n" : "FAIL: output differs\n");
+    return allSame ? 0 : 1;
+}
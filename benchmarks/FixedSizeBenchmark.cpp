@@ -0,0 +1,89 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "FixedSolver.h"
+#include <algorithm>
+
+namespace {
+
+/**
+ * @brief Time an all-starts sweep and keep the best of several rounds
+ * @return Best mean time per solve, in microseconds
+ */
+template<typename SolveFn>
+double timePerSolve(size_t size, size_t rounds, SolveFn solve) {
+    double best = 0.0;
+    for (size_t attempt = 0; attempt < 5; ++attempt) {
+        Timer timer;
+        for (size_t round = 0; round < rounds; ++round) {
+            for (int row = 0; row < static_cast<int>(size); ++row) {
+                for (int col = 0; col < static_cast<int>(size); ++col) {
+                    solve(row, col);
+                }
+            }
+        }
+        double us = static_cast<double>(timer.elapsedMicroseconds()) /
+                    static_cast<double>(rounds * size * size);
+        best = attempt == 0 ? us : std::min(best, us);
+    }
+    return best;
+}
+
+/**
+ * @brief Compare Solver and FixedSolver<N, N> from every start
+ * @return true if both found identical tours with identical backtrack counts
+ */
+template<size_t N>
+bool compareSize(size_t rounds) {
+    Board board(N, N);
+    Solver solver(board);
+    static FixedSolver<N, N> fixed;
+
+    bool match = true;
+    for (int row = 0; row < static_cast<int>(N); ++row) {
+        for (int col = 0; col < static_cast<int>(N); ++col) {
+            bool dynamicSolved = solver.solve(row, col);
+            bool fixedSolved = fixed.solve(row, col);
+            const auto& expected = solver.getPath();
+            auto path = fixed.getPath();
+            match = match && dynamicSolved == fixedSolved &&
+                    solver.getBacktrackCount() == fixed.getBacktrackCount() &&
+                    std::equal(path.begin(), path.end(), expected.begin(), expected.end(),
+                               [](const Move& a, const Move& b) { return a.row == b.row && a.col == b.col; });
+        }
+    }
+
+    double dynamicUs = timePerSolve(N, rounds, [&](int row, int col) { solver.solve(row, col); });
+    double fixedUs = timePerSolve(N, rounds, [&](int row, int col) { fixed.solve(row, col); });
+
+    std::cout << std::left << std::fixed << std::setprecision(2)
+              << std::setw(10) << (std::to_string(N) + "x" + std::to_string(N))
+              << std::setw(14) << dynamicUs
+              << std::setw(14) << fixedUs
+              << std::setw(10) << (fixedUs > 0.0 ? dynamicUs / fixedUs : 0.0)
+              << (match ? "ok" : "MISMATCH")
+              << "\n";
+    return match;
+}
+
+}  // namespace
+
+int runFixedSizeBenchmark() {
+    std::cout << "\n=== Compile-Time Specialized Solver (open tours from every start) ===\n\n";
+    std::cout << std::left
+              << std::setw(10) << "Board"
+              << std::setw(14) << "Solver (us)"
+              << std::setw(14) << "Fixed (us)"
+              << std::setw(10) << "Speedup"
+              << "Check"
+              << "\n";
+    std::cout << std::string(54, '-') << "\n";
+
+    bool allMatch = true;
+    allMatch = compareSize<8>(200) && allMatch;
+    allMatch = compareSize<10>(100) && allMatch;
+    allMatch = compareSize<12>(50) && allMatch;
+
+    std::cout << "\nTimes are the mean per solve over all starts, best of 5 rounds.\n";
+    std::cout << (allMatch ? "PASS: identical tours and backtrack counts\n" : "FAIL: results differ\n");
+    return allMatch ? 0 : 1;
+}
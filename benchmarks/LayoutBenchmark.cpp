@@ -0,0 +1,183 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "KnightGraph.h"
+#include <algorithm>
+#include <bit>
+
+namespace {
+
+// Degree counting as it was done before the padded layout: bounds-check every target
+int countBoundsChecked(const Board& board, int row, int col) {
+    int count = 0;
+    for (const auto& move : Board::KNIGHT_MOVES) {
+        int r = row + move.row;
+        int c = col + move.col;
+        if (board.isValid(r, c) && board.at(r, c) == 0) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+// Degree counting with fixed cell offsets into the padded layout
+int countPadded(const Board& board, size_t cell) {
+    int count = 0;
+    for (ptrdiff_t offset : board.knightOffsets()) {
+        count += !board.isVisitedCell(cell + offset);
+    }
+    return count;
+}
+
+// Degree counting over the shared CSR adjacency table: valid neighbors only,
+// against a flat visited array indexed like the table
+int countAdjacency(const KnightGraph& graph, const std::vector<uint8_t>& visited, size_t index) {
+    int count = 0;
+    for (uint32_t neighbor : graph.neighbors(index)) {
+        count += !visited[neighbor];
+    }
+    return count;
+}
+
+// Bitboard of a board with at most 256 squares: a visited mask plus a
+// knight attack mask per square, so degree is an AND and a popcount
+struct Bitboard {
+    using Mask = std::array<uint64_t, 4>;
+
+    std::vector<Mask> attacks;
+    Mask visited{};
+
+    static constexpr size_t MAX_SQUARES = 256;
+
+    explicit Bitboard(const Board& board) : attacks(board.size(), Mask{}) {
+        for (int row = 0; row < static_cast<int>(board.height()); ++row) {
+            for (int col = 0; col < static_cast<int>(board.width()); ++col) {
+                const size_t index = static_cast<size_t>(row) * board.width() + static_cast<size_t>(col);
+                for (const auto& move : Board::KNIGHT_MOVES) {
+                    const int r = row + move.row;
+                    const int c = col + move.col;
+                    if (board.isValid(r, c)) {
+                        const size_t target = static_cast<size_t>(r) * board.width() + static_cast<size_t>(c);
+                        attacks[index][target >> 6] |= uint64_t{1} << (target & 63);
+                    }
+                }
+                if (board.isVisitedIndex(index)) {
+                    visited[index >> 6] |= uint64_t{1} << (index & 63);
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] int count(size_t index) const noexcept {
+        const Mask& mask = attacks[index];
+        return std::popcount(mask[0] & ~visited[0]) + std::popcount(mask[1] & ~visited[1]) +
+               std::popcount(mask[2] & ~visited[2]) + std::popcount(mask[3] & ~visited[3]);
+    }
+};
+
+/**
+ * @brief Time one degree-counting method over every square
+ * @return Best time per square over several rounds, in nanoseconds
+ */
+template<typename CountFn>
+double timePerSquare(const Board& board, size_t rounds, long long& checksum, CountFn count) {
+    double best = 0.0;
+    for (size_t attempt = 0; attempt < 5; ++attempt) {
+        long long sum = 0;
+        Timer timer;
+        for (size_t round = 0; round < rounds; ++round) {
+            for (int row = 0; row < static_cast<int>(board.height()); ++row) {
+                for (int col = 0; col < static_cast<int>(board.width()); ++col) {
+                    sum += count(row, col);
+                }
+            }
+        }
+        double ns = static_cast<double>(timer.elapsedMicroseconds()) * 1000.0 /
+                    static_cast<double>(rounds * board.size());
+        best = attempt == 0 ? ns : std::min(best, ns);
+        checksum = sum;
+    }
+    return best;
+}
+
+}  // namespace
+
+int runLayoutBenchmark() {
+    struct LayoutCase {
+        size_t size;
+        size_t rounds;
+    };
+    const LayoutCase cases[] = {{8, 200000}, {16, 50000}, {100, 200}};
+
+    std::cout << "\n=== Board Layout Benchmark (degree of every square, 1/3 visited) ===\n\n";
+    std::cout << std::left
+              << std::setw(10) << "Board"
+              << std::setw(26) << "Method"
+              << std::setw(14) << "ns/square"
+              << "vs bounds-checked"
+              << "\n";
+    std::cout << std::string(68, '-') << "\n";
+
+    bool consistent = true;
+    for (const auto& c : cases) {
+        Board board(c.size, c.size);
+        for (size_t index = 0; index < board.size(); index += 3) {
+            board.setByIndex(index, 1);
+        }
+
+        long long reference = 0;
+        long long checksum = 0;
+        const double checked = timePerSquare(board, c.rounds, reference, [&](int row, int col) {
+            return countBoundsChecked(board, row, col);
+        });
+
+        struct Result {
+            const char* method;
+            double ns;
+        };
+        std::vector<Result> results = {{"bounds-checked", checked}};
+
+        results.push_back({"padded cells", timePerSquare(board, c.rounds, checksum, [&](int row, int col) {
+            return countPadded(board, board.cellIndex(row, col));
+        })});
+        consistent = consistent && checksum == reference;
+
+        // CSR adjacency table (still used by divide-and-conquer and counting)
+        const KnightGraph& graph = board.graph();
+        std::vector<uint8_t> visited(board.size());
+        for (size_t index = 0; index < board.size(); ++index) {
+            visited[index] = board.isVisitedIndex(index);
+        }
+        results.push_back({"adjacency table", timePerSquare(board, c.rounds, checksum, [&](int row, int col) {
+            return countAdjacency(graph, visited, graph.toIndex(row, col));
+        })});
+        consistent = consistent && checksum == reference;
+
+        // Bitboard (no longer kept by Board: see README)
+        if (board.size() <= Bitboard::MAX_SQUARES) {
+            const Bitboard bits(board);
+            results.push_back({"bitboard popcount", timePerSquare(board, c.rounds, checksum, [&](int row, int col) {
+                return bits.count(static_cast<size_t>(row) * board.width() + static_cast<size_t>(col));
+            })});
+            consistent = consistent && checksum == reference;
+        }
+
+        // Public API (padded cells behind a bounds check)
+        results.push_back({"countValidMoves",
+                           timePerSquare(board, c.rounds, checksum, [&](int row, int col) {
+            return board.countValidMoves(row, col);
+        })});
+        consistent = consistent && checksum == reference;
+
+        for (const auto& result : results) {
+            std::cout << std::left << std::fixed << std::setprecision(2)
+                      << std::setw(10) << (std::to_string(c.size) + "x" + std::to_string(c.size))
+                      << std::setw(26) << result.method
+                      << std::setw(14) << result.ns
+                      << (result.ns > 0.0 ? checked / result.ns : 0.0) << "x"
+                      << "\n";
+        }
+    }
+
+    std::cout << "\n" << (consistent ? "PASS: all methods agree\n" : "FAIL: methods disagree\n");
+    return consistent ? 0 : 1;
+}
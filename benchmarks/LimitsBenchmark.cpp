@@ -0,0 +1,177 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "TourFeasibility.h"
+#include <chrono>
+#include <stop_token>
+#include <thread>
+
+namespace {
+
+// How far past a limit a solve may run before the check counts as a failure
+constexpr double MAX_OVERSHOOT_MS = 10.0;
+
+// Delay before the cancellation test requests stop
+constexpr int CANCEL_AFTER_MS = 50;
+
+// Median time of an open tour from every start of the first row
+double timeSweep(Board& board, Solver& solver, const SolveOptions& options, size_t rounds) {
+    std::vector<double> times;
+    for (size_t round = 0; round < rounds; ++round) {
+        Timer timer;
+        for (int col = 0; col < static_cast<int>(board.width()); ++col) {
+            solver.solve(0, col, TourType::OPEN, options);
+        }
+        times.push_back(static_cast<double>(timer.elapsedMicroseconds()));
+    }
+    return Statistics::compute(times).median;
+}
+
+struct StopResult {
+    SolveStatus status;
+    double elapsedMs;
+    size_t backtracks;
+};
+
+// A closed tour from this 12x12 corner exists, but the search runs far
+// longer than any limit below (a tour that cannot exist, such as a closed
+// tour on 7x7, is rejected up front by TourFeasibility instead)
+StopResult runUntilStopped(const SolveOptions& options) {
+    Board board(12, 12);
+    Solver solver(board);
+    Timer timer;
+    SolveStatus status = solver.solve(0, 0, TourType::CLOSED, options);
+    return {status, timer.elapsedMicroseconds() / 1000.0, solver.getBacktrackCount()};
+}
+
+bool printStop(const std::string& label, const StopResult& result, SolveStatus expected, double limitMs) {
+    const double overshoot = limitMs >= 0.0 ? result.elapsedMs - limitMs : 0.0;
+    const bool ok = result.status == expected && overshoot < MAX_OVERSHOOT_MS;
+    std::cout << std::left << std::fixed << std::setprecision(2)
+              << std::setw(26) << label
+              << std::setw(18) << solveStatusName(result.status)
+              << std::setw(14) << result.elapsedMs
+              << std::setw(14) << result.backtracks
+              << (ok ? "yes" : "NO")
+              << "\n";
+    return ok;
+}
+
+}  // namespace
+
+int runLimitsBenchmark() {
+    std::cout << "\n=== Solve Limits Benchmark ===\n\n";
+
+    // Cost of polling the limits on solves that never hit them
+    std::cout << std::left
+              << std::setw(12) << "Board"
+              << std::setw(18) << "No limits (μs)"
+              << std::setw(18) << "Limits set (μs)"
+              << "Overhead"
+              << "\n";
+    std::cout << std::string(60, '-') << "\n";
+
+    const size_t sizes[] = {8, 50, 200};
+    for (size_t size : sizes) {
+        Board board(size, size);
+        Solver solver(board);
+        SolveOptions limited = SolveOptions::withTimeout(std::chrono::hours(1));
+        limited.maxBacktracks = size_t{1} << 40;
+        std::stop_source neverStopped;
+        limited.stopToken = neverStopped.get_token();
+
+        const size_t rounds = size <= 50 ? 20 : 3;
+        const double unlimitedUs = timeSweep(board, solver, SolveOptions{}, rounds);
+        const double limitedUs = timeSweep(board, solver, limited, rounds);
+        const double overhead = unlimitedUs > 0.0 ? (limitedUs / unlimitedUs - 1.0) * 100.0 : 0.0;
+        std::cout << std::left << std::fixed << std::setprecision(2)
+                  << std::setw(12) << (std::to_string(size) + "x" + std::to_string(size))
+                  << std::setw(18) << unlimitedUs
+                  << std::setw(18) << limitedUs
+                  << std::showpos << overhead << std::noshowpos << "%"
+                  << "\n";
+    }
+
+    // How promptly each limit stops a search that would otherwise run for hours
+    std::cout << "\nClosed tour on 12x12 from (0,0):\n\n";
+    std::cout << std::left
+              << std::setw(26) << "Limit"
+              << std::setw(18) << "Status"
+              << std::setw(14) << "Time (ms)"
+              << std::setw(14) << "Backtracks"
+              << "In time"
+              << "\n";
+    std::cout << std::string(78, '-') << "\n";
+
+    bool ok = true;
+    for (int millis : {10, 50, 200}) {
+        auto result = runUntilStopped(SolveOptions::withTimeout(std::chrono::milliseconds(millis)));
+        ok = printStop("timeout " + std::to_string(millis) + " ms", result, SolveStatus::TIMED_OUT, millis) && ok;
+    }
+
+    SolveOptions budget;
+    budget.maxBacktracks = 1000000;
+    auto budgetResult = runUntilStopped(budget);
+    ok = printStop("budget 1000000 backtracks", budgetResult, SolveStatus::BUDGET_EXHAUSTED, -1.0) && ok;
+    ok = ok && budgetResult.backtracks >= budget.maxBacktracks;
+
+    SolveOptions nodes;
+    nodes.maxNodes = 1000000;
+    ok = printStop("budget 1000000 nodes", runUntilStopped(nodes), SolveStatus::BUDGET_EXHAUSTED, -1.0) && ok;
+
+    std::stop_source cancel;
+    SolveOptions cancellable;
+    cancellable.stopToken = cancel.get_token();
+    std::jthread canceller([&cancel] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(CANCEL_AFTER_MS));
+        cancel.request_stop();
+    });
+    ok = printStop("cancel after " + std::to_string(CANCEL_AFTER_MS) + " ms", runUntilStopped(cancellable),
+                   SolveStatus::CANCELLED, CANCEL_AFTER_MS) && ok;
+
+    // Tours that cannot exist are answered without searching
+    struct Impossible {
+        size_t width;
+        size_t height;
+        int startRow;
+        int startCol;
+        TourType type;
+    };
+    const Impossible impossible[] = {
+        {7, 7, 0, 0, TourType::CLOSED},
+        {4, 10, 0, 0, TourType::CLOSED},
+        {3, 8, 0, 0, TourType::CLOSED},
+        {3, 6, 0, 0, TourType::OPEN},
+        {9, 9, 0, 1, TourType::OPEN},
+        {4, 8, 3, 1, TourType::OPEN},
+    };
+    std::cout << "\nImpossible tours:\n\n";
+    std::cout << std::left
+              << std::setw(26) << "Request"
+              << std::setw(18) << "Status"
+              << std::setw(14) << "Time (μs)"
+              << "Reason"
+              << "\n";
+    std::cout << std::string(100, '-') << "\n";
+    for (const auto& request : impossible) {
+        Board board(request.width, request.height);
+        Solver solver(board);
+        Timer timer;
+        SolveStatus status = solver.solve(request.startRow, request.startCol, request.type, SolveOptions{});
+        const long long micros = timer.elapsedMicroseconds();
+        const char* reason = TourFeasibility::whyImpossible(request.width, request.height, request.startRow,
+                                                            request.startCol, request.type);
+        ok = ok && status == SolveStatus::UNSOLVABLE && reason != nullptr && micros < 1000;
+        std::cout << std::left
+                  << std::setw(26) << (std::to_string(request.width) + "x" + std::to_string(request.height) + " " +
+                                       (request.type == TourType::CLOSED ? "closed" : "open") + " from " +
+                                       std::to_string(request.startRow) + "," + std::to_string(request.startCol))
+                  << std::setw(18) << solveStatusName(status)
+                  << std::setw(14) << micros
+                  << (reason ? reason : "NOT RULED OUT")
+                  << "\n";
+    }
+
+    std::cout << "\n" << (ok ? "PASS: every limit stopped the search in time, impossible tours were rejected\n"
+                             : "FAIL: a limit was missed or overshot, or an impossible tour was searched\n");
+    return ok ? 0 : 1;
+}
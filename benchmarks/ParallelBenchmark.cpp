@@ -0,0 +1,94 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "ParallelSolver.h"
+#include <thread>
+
+namespace {
+
+struct ScalingCase {
+    size_t width;
+    size_t height;
+    int startRow;
+    int startCol;
+    TourType type;
+    bool expectTour;
+    size_t runs;
+    const char* description;
+};
+
+}  // namespace
+
+int runParallelBenchmark() {
+    const ScalingCase cases[] = {
+        {5, 5, 0, 0, TourType::CLOSED, false, 5, "5x5 closed (exhaustive, no tour)"},
+        {8, 4, 0, 0, TourType::CLOSED, false, 1, "8x4 closed (exhaustive, no tour)"},
+        {6, 6, 0, 0, TourType::CLOSED, true, 3, "6x6 closed from (0,0) (first tour; order-dependent)"},
+    };
+
+    // Powers of two up to the core count, and at least 4 so stealing is exercised
+    const size_t cores = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<size_t> threadCounts;
+    for (size_t threads = 1; threads <= std::max<size_t>(cores, 4); threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+
+    std::cout << "\n=== Parallel Search Scaling (work-stealing, " << cores << " hardware threads) ===\n";
+
+    bool allCorrect = true;
+    for (const auto& c : cases) {
+        std::cout << "\n" << c.description << "\n";
+        std::cout << std::left
+                  << std::setw(10) << "Threads"
+                  << std::setw(14) << "Median (ms)"
+                  << std::setw(10) << "Speedup"
+                  << std::setw(12) << "Efficiency"
+                  << std::setw(8) << "Tasks"
+                  << std::setw(8) << "Steals"
+                  << "Result"
+                  << "\n";
+        std::cout << std::string(70, '-') << "\n";
+
+        double baseline = 0.0;
+        for (size_t threads : threadCounts) {
+            Board board(c.width, c.height);
+            ParallelSolver solver(board, threads);
+            solver.setFeasibilityCheck(false);  // Time the exhaustive search, not the O(1) rejection
+
+            std::vector<double> times;
+            bool found = false;
+            for (size_t i = 0; i < c.runs; ++i) {
+                Timer timer;
+                found = solver.solve(c.startRow, c.startCol, c.type);
+                times.push_back(timer.elapsedMilliseconds());
+            }
+
+            bool correct = found == c.expectTour;
+            if (found) {
+                Solver checker(board);
+                correct = correct && checker.setSolution(solver.getPath(), c.type);
+            }
+            allCorrect = allCorrect && correct;
+
+            double median = Statistics::compute(times).median;
+            if (threads == 1) {
+                baseline = median;
+            }
+            double speedup = median > 0.0 ? baseline / median : 0.0;
+            std::cout << std::left << std::fixed << std::setprecision(2)
+                      << std::setw(10) << threads
+                      << std::setw(14) << median
+                      << std::setw(10) << speedup
+                      << std::setw(12) << (speedup / static_cast<double>(threads))
+                      << std::setw(8) << solver.getTaskCount()
+                      << std::setw(8) << solver.getStealCount()
+                      << (!correct ? "WRONG" : found ? "tour" : "none")
+                      << "\n";
+        }
+    }
+
+    if (cores < 2) {
+        std::cout << "\nNote: single hardware thread, so no speedup is possible here.\n";
+    }
+    std::cout << "\n" << (allCorrect ? "PASS: all results correct\n" : "FAIL: wrong result\n");
+    return allCorrect ? 0 : 1;
+}
@@ -0,0 +1,109 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "DivideAndConquerSolver.h"
+#include "Exporter.h"
+#include "MappedFile.h"
+#include "PngWriter.h"
+#include <filesystem>
+
+namespace {
+
+uint32_t readBigEndian(const uint8_t* p) {
+    return (uint32_t{p[0]} << 24) | (uint32_t{p[1]} << 16) | (uint32_t{p[2]} << 8) | uint32_t{p[3]};
+}
+
+// Check the PNG signature, chunk layout and CRCs; return the IHDR size (0x0 if invalid)
+std::pair<uint32_t, uint32_t> checkPng(const std::string& filename) {
+    static constexpr uint8_t SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    MappedFile file(filename);
+    const uint8_t* data = file.data();
+    const size_t size = file.size();
+    if (size < 8 || !std::equal(SIGNATURE, SIGNATURE + 8, data)) {
+        return {0, 0};
+    }
+
+    std::pair<uint32_t, uint32_t> dimensions{0, 0};
+    size_t at = 8;
+    while (at + 12 <= size) {
+        const uint32_t length = readBigEndian(data + at);
+        if (at + 12 + length > size ||
+            PngWriter::crc32(data + at + 4, length + 4) != readBigEndian(data + at + 8 + length)) {
+            return {0, 0};
+        }
+        const std::string type(reinterpret_cast<const char*>(data + at + 4), 4);
+        if (type == "IHDR") {
+            dimensions = {readBigEndian(data + at + 8), readBigEndian(data + at + 12)};
+        }
+        at += 12 + length;
+        if (type == "IEND") {
+            return at == size ? dimensions : std::pair<uint32_t, uint32_t>{0, 0};
+        }
+    }
+    return {0, 0};
+}
+
+}  // namespace
+
+int runPngBenchmark() {
+    const size_t sizes[] = {8, 100, 1000};
+    const int runs = 5;
+    const double targetMs = 100.0;
+    const std::string filename = (std::filesystem::temp_directory_path() / "knights_tour_png_bench.png").string();
+
+    std::cout << "\n=== PNG export: rasterize + built-in deflate (closed tours, best of " << runs << ") ===\n\n";
+    std::cout << std::left
+              << std::setw(11) << "Board"
+              << std::setw(13) << "Image"
+              << std::setw(12) << "Raw (MB)"
+              << std::setw(12) << "PNG (KB)"
+              << std::setw(11) << "Ratio"
+              << std::setw(11) << "Time (ms)"
+              << "Valid"
+              << "\n";
+    std::cout << std::string(75, '-') << "\n";
+
+    bool allValid = true;
+    double largestMs = 0.0;
+    for (size_t size : sizes) {
+        Board board(size, size);
+        Solver solver(board);
+        DivideAndConquerSolver builder(board);
+        if (!builder.solve(0, 0, TourType::CLOSED) || !solver.setSolution(builder.getPath(), TourType::CLOSED)) {
+            std::cout << size << "x" << size << ": no tour\n";
+            allValid = false;
+            continue;
+        }
+
+        double bestMs = 0.0;
+        bool written = true;
+        for (int run = 0; run < runs; ++run) {
+            Timer timer;
+            written = Exporter::exportToPNG(solver, board, filename) && written;
+            const double ms = timer.elapsedMilliseconds();
+            bestMs = run == 0 ? ms : std::min(bestMs, ms);
+        }
+
+        const auto [width, height] = checkPng(filename);
+        const bool valid = written && width > 0 && width % size == 0 && height % size == 0;
+        allValid = allValid && valid;
+        largestMs = bestMs;
+
+        const double rawBytes = 4.0 * width * height;
+        const double pngBytes = static_cast<double>(std::filesystem::file_size(filename));
+        std::cout << std::left << std::fixed << std::setprecision(2)
+                  << std::setw(11) << (std::to_string(size) + "x" + std::to_string(size))
+                  << std::setw(13) << (std::to_string(width) + "x" + std::to_string(height))
+                  << std::setw(12) << rawBytes / (1024.0 * 1024.0)
+                  << std::setw(12) << pngBytes / 1024.0
+                  << std::setw(11) << (pngBytes > 0.0 ? rawBytes / pngBytes : 0.0)
+                  << std::setw(11) << bestMs
+                  << (valid ? "yes" : "NO")
+                  << "\n";
+    }
+
+    std::filesystem::remove(filename);
+    std::cout << "\nTarget: 1000x1000 under " << targetMs << " ms: "
+              << (largestMs < targetMs ? "met" : "missed") << "\n";
+    std::cout << (allValid ? "PASS: every PNG is well-formed\n" : "FAIL: invalid PNG output\n");
+    return allValid ? 0 : 1;
+}
@@ -0,0 +1,96 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "SolverPool.h"
+#include <thread>
+
+int runPoolBenchmark() {
+    const size_t size = 50;
+    const size_t starts = size * size;
+    const size_t cores = std::max(1u, std::thread::hardware_concurrency());
+
+    std::cout << "\n=== Start-position sweep: every open tour start on " << size << "x" << size
+              << " (" << cores << " core" << (cores == 1 ? "" : "s") << ") ===\n\n";
+    std::cout << std::left
+              << std::setw(30) << "Mode"
+              << std::setw(12) << "Time (ms)"
+              << std::setw(14) << "Solves/s"
+              << std::setw(10) << "Boards"
+              << "Solved"
+              << "\n";
+    std::cout << std::string(72, '-') << "\n";
+
+    auto report = [](const std::string& mode, double ms, double solvesPerSecond, size_t boards, size_t solved) {
+        std::cout << std::left << std::fixed << std::setprecision(1)
+                  << std::setw(30) << mode
+                  << std::setw(12) << ms
+                  << std::setw(14) << std::setprecision(0) << solvesPerSecond
+                  << std::setw(10) << boards
+                  << solved
+                  << "\n";
+    };
+
+    std::vector<SolveJob> jobs;
+    for (size_t row = 0; row < size; ++row) {
+        for (size_t col = 0; col < size; ++col) {
+            SolveJob job;
+            job.width = job.height = size;
+            job.startRow = static_cast<int>(row);
+            job.startCol = static_cast<int>(col);
+            jobs.push_back(job);
+        }
+    }
+
+    // A new Board and Solver per start, as testAllPositions used to do
+    size_t freshSolved = 0;
+    Timer freshTimer;
+    for (const auto& job : jobs) {
+        Board board(job.width, job.height);
+        Solver solver(board);
+        freshSolved += solver.solve(job.startRow, job.startCol, job.type) ? 1 : 0;
+    }
+    const double freshMs = freshTimer.elapsedMilliseconds();
+    report("Fresh board per start", freshMs, starts * 1000.0 / freshMs, starts, freshSolved);
+
+    // One reused workspace on this thread
+    SolverWorkspace workspace;
+    size_t reusedSolved = 0;
+    Timer reusedTimer;
+    for (const auto& job : jobs) {
+        reusedSolved += workspace.solve(job) ? 1 : 0;
+    }
+    const double reusedMs = reusedTimer.elapsedMilliseconds();
+    report("One workspace", reusedMs, starts * 1000.0 / reusedMs, workspace.getBoardAllocations(), reusedSolved);
+
+    // The pool at increasing thread counts, results through callbacks
+    std::vector<size_t> threadCounts = {1, 2, 4};
+    if (cores > 4) {
+        threadCounts.push_back(cores);
+    }
+
+    bool ok = reusedSolved == freshSolved;
+    double bestRate = 0.0;
+    for (size_t threads : threadCounts) {
+        SolverPool pool(threads);
+        std::atomic<size_t> solved{0};
+        Timer timer;
+        for (const auto& job : jobs) {
+            pool.submit(job, [&solved](SolveResult&& result) {
+                if (result.solved) {
+                    ++solved;
+                }
+            });
+        }
+        pool.wait();
+        const double ms = timer.elapsedMilliseconds();
+        const double rate = pool.getSolvesPerSecond();
+        bestRate = std::max(bestRate, rate);
+        report("SolverPool, " + std::to_string(threads) + " thread" + (threads == 1 ? "" : "s"), ms, rate,
+               pool.getBoardAllocations(), solved.load());
+        ok = ok && solved.load() == freshSolved && pool.getCompletedCount() == starts;
+    }
+
+    std::cout << "\nBest pool throughput: " << std::setprecision(2) << bestRate * freshMs / (starts * 1000.0)
+              << "x the fresh-board loop\n";
+    std::cout << (ok ? "PASS: every mode solves the same starts\n" : "FAIL: solved counts differ\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,114 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "PortfolioSolver.h"
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+constexpr auto TIME_LIMIT = std::chrono::milliseconds(200);
+constexpr size_t PORTFOLIO_THREADS = 4;
+
+struct SweepResult {
+    size_t solved = 0;
+    std::vector<double> times;   // Wall time of every attempt, including timeouts
+};
+
+// Run one attempt, requesting stop after TIME_LIMIT
+bool runWithTimeLimit(const std::function<bool(std::stop_token)>& attempt, double& elapsedMs) {
+    std::stop_source stopSource;
+    std::jthread watchdog([&stopSource](std::stop_token done) {
+        std::mutex mutex;
+        std::condition_variable_any wake;
+        std::unique_lock<std::mutex> lock(mutex);
+        wake.wait_for(lock, done, TIME_LIMIT, [] { return false; });
+        stopSource.request_stop();
+    });
+
+    Timer timer;
+    bool solved = attempt(stopSource.get_token());
+    elapsedMs = timer.elapsedMilliseconds();
+    watchdog.request_stop();
+    return solved;
+}
+
+void printRow(const std::string& label, SweepResult& result, size_t attempts) {
+    auto timing = Statistics::compute(result.times);
+    std::cout << std::left << std::fixed << std::setprecision(2)
+              << std::setw(14) << label
+              << std::setw(12) << (std::to_string(result.solved) + "/" + std::to_string(attempts))
+              << std::setw(14) << timing.median
+              << std::setw(14) << timing.max
+              << "\n";
+}
+
+}  // namespace
+
+int runPortfolioBenchmark() {
+    const size_t sizes[] = {8, 10, 12};
+
+    std::cout << "\n=== Portfolio Benchmark (closed tours from every start on row 0, "
+              << TIME_LIMIT.count() << " ms limit, "
+              << PORTFOLIO_THREADS << " strategies) ===\n\n";
+    std::cout << std::left
+              << std::setw(14) << "Board"
+              << std::setw(14) << "Solver"
+              << std::setw(12) << "Solved"
+              << std::setw(14) << "Median (ms)"
+              << std::setw(14) << "Max (ms)"
+              << "\n";
+    std::cout << std::string(68, '-') << "\n";
+
+    bool allValid = true;
+    bool neverWorse = true;
+    for (size_t size : sizes) {
+        SweepResult single;
+        SweepResult portfolio;
+
+        for (int col = 0; col < static_cast<int>(size); ++col) {
+            Board board(size, size);
+            double elapsed = 0.0;
+
+            Solver solver(board);
+            bool solved = runWithTimeLimit([&](std::stop_token token) {
+                solver.setStopToken(std::move(token));
+                return solver.solve(0, col, TourType::CLOSED);
+            }, elapsed);
+            single.solved += solved ? 1 : 0;
+            single.times.push_back(elapsed);
+
+            PortfolioSolver racer(board, PORTFOLIO_THREADS);
+            solved = runWithTimeLimit([&](std::stop_token token) {
+                racer.setStopToken(std::move(token));
+                return racer.solve(0, col, TourType::CLOSED);
+            }, elapsed);
+            portfolio.solved += solved ? 1 : 0;
+            portfolio.times.push_back(elapsed);
+
+            if (solved) {
+                Solver checker(board);
+                allValid = checker.setSolution(racer.getPath(), TourType::CLOSED) && allValid;
+            }
+        }
+
+        std::string label = std::to_string(size) + "x" + std::to_string(size);
+        std::cout << std::setw(14) << label;
+        printRow("single", single, size);
+        std::cout << std::setw(14) << "";
+        printRow("portfolio", portfolio, size);
+        neverWorse = neverWorse && portfolio.solved >= single.solved;
+    }
+
+    std::cout << "\nNote: strategies share the available cores, so on a machine with fewer\n"
+              << "than " << PORTFOLIO_THREADS << " cores each one runs proportionally slower.\n";
+    if (!allValid) {
+        std::cout << "FAIL: invalid tour\n";
+        return 1;
+    }
+    std::cout << (neverWorse ? "PASS: portfolio solved at least as many starts\n"
+                             : "WARN: portfolio solved fewer starts (time-sliced strategies)\n");
+    return 0;
+}
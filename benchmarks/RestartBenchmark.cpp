@@ -0,0 +1,132 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "SymmetrySweep.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+namespace {
+
+// Per-solve time limit, well above the restarted tail on the boards where
+// restarts solve every start. A start that hits it is censored: its time
+// is only known to exceed the limit, and a quantile that falls on it is
+// printed as ">limit".
+constexpr int TIMEOUT_MS = 200;
+
+// Luby restart unit, in backtracks
+constexpr size_t RESTART_UNIT = 300;
+
+constexpr double CENSORED = std::numeric_limits<double>::infinity();
+
+struct SweepTimes {
+    std::vector<double> times;  // Sorted; CENSORED for starts without a tour
+    size_t solved;
+    size_t restarts;
+    bool valid;  // Every tour is a closed tour from its start
+
+    // Nearest-rank quantile (no interpolation across a censored sample)
+    [[nodiscard]] double quantile(double q) const {
+        const auto rank = static_cast<size_t>(std::ceil(q * static_cast<double>(times.size())));
+        return times[std::clamp<size_t>(rank, 1, times.size()) - 1];
+    }
+};
+
+// Closed tour from each orbit representative of a square board
+SweepTimes sweepClosed(size_t size, size_t restartUnit) {
+    Board board(size, size);
+    Solver solver(board);
+    Board checkBoard(size, size);
+    Solver checker(checkBoard);
+    SymmetrySweep sweep(size, size);
+
+    SweepTimes result{{}, 0, 0, true};
+    for (const auto& orbit : sweep.orbits()) {
+        const Move start = orbit.squares.front();
+        SolveOptions options = SolveOptions::withTimeout(std::chrono::milliseconds(TIMEOUT_MS));
+        options.restartBacktracks = restartUnit;
+
+        Timer timer;
+        const SolveStatus status = solver.solve(start.row, start.col, TourType::CLOSED, options);
+        const double ms = timer.elapsedMilliseconds();
+
+        result.restarts += solver.getRestartCount();
+        if (status == SolveStatus::SOLVED) {
+            ++result.solved;
+            result.times.push_back(ms);
+            const auto& path = solver.getPath();
+            result.valid = result.valid && path.front().row == start.row && path.front().col == start.col &&
+                           checker.setSolution(path, TourType::CLOSED);
+        } else {
+            result.times.push_back(CENSORED);
+        }
+    }
+    std::sort(result.times.begin(), result.times.end());
+    return result;
+}
+
+std::string formatTime(double ms) {
+    std::ostringstream text;
+    if (ms == CENSORED) {
+        text << ">" << TIMEOUT_MS;
+    } else {
+        text << std::fixed << std::setprecision(2) << ms;
+    }
+    return text.str();
+}
+
+void printRow(const std::string& mode, const SweepTimes& result) {
+    std::cout << std::left
+              << std::setw(12) << mode
+              << std::setw(12) << (std::to_string(result.solved) + "/" + std::to_string(result.times.size()))
+              << std::setw(13) << formatTime(result.quantile(0.5))
+              << std::setw(13) << formatTime(result.quantile(0.9))
+              << std::setw(13) << formatTime(result.quantile(0.99))
+              << std::setw(13) << formatTime(result.times.back())
+              << result.restarts
+              << "\n";
+}
+
+}  // namespace
+
+int runRestartBenchmark() {
+    const size_t sizes[] = {8, 12, 16, 20, 30, 50};
+
+    std::cout << "\n=== Luby Restarts (closed tours from every orbit representative) ===\n\n";
+    std::cout << "Time limit " << TIMEOUT_MS << " ms per solve (\">" << TIMEOUT_MS
+              << "\": the quantile falls on a start without a tour), restart unit " << RESTART_UNIT
+              << " backtracks\n";
+
+    bool ok = true;
+    for (size_t size : sizes) {
+        std::cout << "\n" << size << "x" << size << ":\n";
+        std::cout << std::left
+                  << std::setw(12) << "Mode"
+                  << std::setw(12) << "Solved"
+                  << std::setw(13) << "Median (ms)"
+                  << std::setw(13) << "p90 (ms)"
+                  << std::setw(13) << "p99 (ms)"
+                  << std::setw(13) << "Max (ms)"
+                  << "Restarts"
+                  << "\n";
+        std::cout << std::string(84, '-') << "\n";
+
+        const SweepTimes fixed = sweepClosed(size, 0);
+        const SweepTimes restarted = sweepClosed(size, RESTART_UNIT);
+        printRow("fixed", fixed);
+        printRow("restarts", restarted);
+
+        // The tail must not grow, and must shrink wherever restarts measure it
+        const double fixedP99 = fixed.quantile(0.99);
+        const double restartedP99 = restarted.quantile(0.99);
+        const bool tail = restartedP99 <= fixedP99 && restarted.times.back() <= fixed.times.back() &&
+                          (restartedP99 == CENSORED || restartedP99 < fixedP99);
+        ok = ok && fixed.valid && restarted.valid && restarted.solved >= fixed.solved && tail;
+    }
+
+    std::cout << "\n" << (ok ? "PASS: restarts solved at least as many starts, shortened every measured p99, "
+                               "every tour is valid\n"
+                             : "FAIL: restarts solved fewer starts or lengthened the tail, or a tour is invalid\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,281 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "SolveServer.h"
+#include "TourFile.h"
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <thread>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+struct ClientStats {
+    size_t responses = 0;
+    size_t solved = 0;
+};
+
+int connectTo(const std::string& path) {
+    int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    if (fd >= 0 && ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        ::close(fd);
+        fd = -1;
+    }
+    return fd;
+}
+
+bool sendAll(int fd, const char* data, size_t size) {
+    while (size > 0) {
+        const ssize_t bytes = ::send(fd, data, size, MSG_NOSIGNAL);
+        if (bytes <= 0) {
+            return false;
+        }
+        data += bytes;
+        size -= static_cast<size_t>(bytes);
+    }
+    return true;
+}
+
+// Read frames until `count` responses have arrived, checking each one
+bool readResponses(int fd, size_t count, std::string& buffer, ClientStats& stats) {
+    size_t offset = 0;
+    char chunk[1 << 16];
+    while (stats.responses < count) {
+        uint32_t length;
+        if (buffer.size() - offset >= sizeof(length)) {
+            std::memcpy(&length, buffer.data() + offset, sizeof(length));
+            if (buffer.size() - offset >= sizeof(length) + length) {
+                std::string_view payload(buffer.data() + offset + sizeof(length), length);
+                offset += sizeof(length) + length;
+                ++stats.responses;
+                if (payload.starts_with("{")) {
+                    stats.solved += payload.find("\"solved\":true") != std::string_view::npos ? 1 : 0;
+                } else if (payload.size() >= sizeof(TourFileHeader)) {
+                    TourFileHeader header;
+                    std::memcpy(&header, payload.data(), sizeof(header));
+                    stats.solved += header.moveCount == uint64_t{header.width} * header.height ? 1 : 0;
+                }
+                continue;
+            }
+        }
+        buffer.erase(0, offset);
+        offset = 0;
+        const ssize_t bytes = ::recv(fd, chunk, sizeof(chunk), 0);
+        if (bytes <= 0) {
+            return false;
+        }
+        buffer.append(chunk, static_cast<size_t>(bytes));
+    }
+    buffer.erase(0, offset);
+    return true;
+}
+
+// Resident set size of this process (server included), in kilobytes
+size_t residentKilobytes() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with("VmRSS:")) {
+            return std::stoul(line.substr(6));
+        }
+    }
+    return 0;
+}
+
+}  // namespace
+
+int runServeBenchmark() {
+    const size_t requestCount = 20000;
+    constexpr int FLOOD_MS = 1000;
+    constexpr size_t MAX_FLOOD_GROWTH_KB = 64 * 1024;
+    const size_t sizes[] = {8, 8, 16, 20, 30};
+    const std::string path = "/tmp/knights_tour_bench_" + std::to_string(::getpid()) + ".sock";
+
+    std::mt19937 random(42);
+    std::vector<std::string> binaryFrames;
+    std::vector<std::string> jsonFrames;
+    std::vector<BatchJob> jobs;
+    for (size_t i = 0; i < requestCount; ++i) {
+        const size_t size = sizes[random() % std::size(sizes)];
+        BatchJob job;
+        job.width = job.height = size;
+        job.startRow = static_cast<int>(random() % size);
+        job.startCol = static_cast<int>(random() % size);
+        jobs.push_back(job);
+
+        SolveRequestHeader request{};
+        std::memcpy(request.magic, SolveServer::REQUEST_MAGIC, sizeof(request.magic));
+        request.width = request.height = static_cast<uint32_t>(size);
+        request.startRow = job.startRow;
+        request.startCol = job.startCol;
+        binaryFrames.emplace_back();
+        SolveServer::appendFrame(std::string_view(reinterpret_cast<const char*>(&request), sizeof(request)),
+                                 binaryFrames.back());
+
+        jsonFrames.emplace_back();
+        SolveServer::appendFrame("{\"size\":" + std::to_string(size) + ",\"start\":[" + std::to_string(job.startRow) +
+                                 "," + std::to_string(job.startCol) + "]}", jsonFrames.back());
+    }
+
+    const size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    SolveServer server(path, threads);
+    std::jthread loop([&server] { server.run(); });
+
+    std::cout << "\n=== Unix socket server: " << requestCount << " open tours, sizes 8-30, "
+              << threads << " solver thread" << (threads == 1 ? "" : "s") << " ===\n\n";
+    std::cout << std::left
+              << std::setw(34) << "Mode"
+              << std::setw(12) << "Time (ms)"
+              << std::setw(14) << "Requests/s"
+              << "Solved"
+              << "\n";
+    std::cout << std::string(66, '-') << "\n";
+
+    auto report = [](const char* mode, double ms, size_t solved) {
+        std::cout << std::left << std::fixed << std::setprecision(1)
+                  << std::setw(34) << mode
+                  << std::setw(12) << ms
+                  << std::setw(14) << std::setprecision(0) << (ms > 0.0 ? requestCount * 1000.0 / ms : 0.0)
+                  << solved
+                  << "\n";
+    };
+
+    // In-process baseline: the same solves without a socket
+    SolverWorkspace workspace;
+    size_t directSolved = 0;
+    Timer directTimer;
+    for (const auto& job : jobs) {
+        directSolved += workspace.solve(job) ? 1 : 0;
+    }
+    report("In-process (no socket)", directTimer.elapsedMilliseconds(), directSolved);
+
+    bool ok = true;
+
+    // One request at a time: every request waits for the previous response
+    {
+        int fd = connectTo(path);
+        ClientStats stats;
+        std::string buffer;
+        Timer timer;
+        for (size_t i = 0; i < requestCount && fd >= 0; ++i) {
+            if (!sendAll(fd, binaryFrames[i].data(), binaryFrames[i].size()) ||
+                !readResponses(fd, i + 1, buffer, stats)) {
+                break;
+            }
+        }
+        report("Request/response, binary", timer.elapsedMilliseconds(), stats.solved);
+        ok = ok && stats.responses == requestCount && stats.solved == directSolved;
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+
+    // Pipelined: a writer thread streams every request while this thread reads
+    auto pipelined = [&](const char* mode, const std::vector<std::string>& frames) {
+        int fd = connectTo(path);
+        ClientStats stats;
+        std::string buffer;
+        Timer timer;
+        if (fd >= 0) {
+            std::jthread writer([fd, &frames] {
+                for (const auto& frame : frames) {
+                    if (!sendAll(fd, frame.data(), frame.size())) {
+                        break;
+                    }
+                }
+            });
+            readResponses(fd, requestCount, buffer, stats);
+        }
+        report(mode, timer.elapsedMilliseconds(), stats.solved);
+        ok = ok && stats.responses == requestCount && stats.solved == directSolved;
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    };
+    pipelined("Pipelined, binary (.kt replies)", binaryFrames);
+    pipelined("Pipelined, JSON", jsonFrames);
+
+    // A client that floods requests without reading: the server must stop
+    // reading it instead of buffering the replies, then answer everything
+    // once the client reads
+    std::cout << "\nClient that does not read (30x30 JSON requests for " << FLOOD_MS << " ms):\n";
+    {
+        std::string flood;
+        SolveServer::appendFrame("{\"size\":30,\"start\":[0,0]}", flood);
+        const size_t frameSize = flood.size();
+        std::string burst;
+        for (size_t i = 0; i < 256; ++i) {
+            burst += flood;
+        }
+
+        int fd = connectTo(path);
+        const size_t before = residentKilobytes();
+        size_t sentBytes = 0;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(FLOOD_MS);
+        while (fd >= 0 && std::chrono::steady_clock::now() < deadline) {
+            const size_t offset = sentBytes % burst.size();
+            const ssize_t bytes = ::send(fd, burst.data() + offset, burst.size() - offset,
+                                         MSG_NOSIGNAL | MSG_DONTWAIT);
+            if (bytes > 0) {
+                sentBytes += static_cast<size_t>(bytes);
+            } else {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+        const size_t after = residentKilobytes();
+        const size_t growth = after > before ? after - before : 0;
+        const size_t requests = (sentBytes + frameSize - 1) / frameSize;
+
+        ClientStats stats;
+        Timer timer;
+        if (fd >= 0) {
+            std::jthread writer([&] {
+                // Finish the last partial frame, then let the server see the end of the requests
+                const size_t remainder = requests * frameSize - sentBytes;
+                sendAll(fd, flood.data() + frameSize - remainder, remainder);
+                ::shutdown(fd, SHUT_WR);
+            });
+            std::string buffer;
+            readResponses(fd, requests, buffer, stats);
+        }
+        const double drainMs = timer.elapsedMilliseconds();
+
+        std::cout << std::left
+                  << "  Requests accepted before the client blocked: " << requests << "\n"
+                  << "  Memory growth while flooding: " << growth / 1024 << " MB (limit "
+                  << MAX_FLOOD_GROWTH_KB / 1024 << " MB)\n"
+                  << "  Replies read afterwards: " << stats.responses << " in " << std::fixed
+                  << std::setprecision(1) << drainMs << " ms\n";
+        ok = ok && requests > 0 && stats.responses == requests && stats.solved == requests &&
+             growth < MAX_FLOOD_GROWTH_KB;
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+
+    server.stop();
+    loop.join();
+
+    std::cout << "\n" << server.getRequestCount() << " requests on " << server.getConnectionCount()
+              << " connections\n";
+    std::cout << (ok ? "PASS: every request answered in order with a tour, a client that does not read stays bounded\n"
+                 : "FAIL: missing or unsolved replies, or a client that does not read grew the server\n");
+    return ok ? 0 : 1;
+}
+
+#else
+
+int runServeBenchmark() {
+    std::cout << "\nThe solve server needs epoll (Linux); skipped\n";
+    return 0;
+}
+
+#endif
@@ -0,0 +1,69 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "SymmetrySweep.h"
+
+int runSymmetryBenchmark() {
+    const size_t sizes[] = {8, 20, 30, 50};
+
+    std::cout << "\n=== Symmetry-Reduced Sweep (open tours from every start) ===\n\n";
+    std::cout << std::left
+              << std::setw(10) << "Board"
+              << std::setw(10) << "Squares"
+              << std::setw(9) << "Orbits"
+              << std::setw(13) << "Full (ms)"
+              << std::setw(13) << "Sweep (ms)"
+              << std::setw(10) << "Speedup"
+              << "Check"
+              << "\n";
+    std::cout << std::string(72, '-') << "\n";
+
+    bool allMatch = true;
+    for (size_t size : sizes) {
+        Board board(size, size);
+        Solver solver(board);
+
+        // Full sweep: one solve per square
+        std::vector<bool> fullSolved(board.size());
+        Timer fullTimer;
+        for (size_t index = 0; index < board.size(); ++index) {
+            fullSolved[index] = solver.solve(static_cast<int>(index / size), static_cast<int>(index % size));
+        }
+        double fullMs = fullTimer.elapsedMilliseconds();
+
+        // Symmetric sweep, timed with a callback that only records outcomes
+        SymmetrySweep sweep(size, size);
+        std::vector<bool> sweepSolved(board.size());
+        Timer sweepTimer;
+        sweep.run(solver, TourType::OPEN, [&](const SweepResult& result) {
+            sweepSolved[static_cast<size_t>(result.start.row) * size + static_cast<size_t>(result.start.col)] = result.solved;
+        });
+        double sweepMs = sweepTimer.elapsedMilliseconds();
+
+        // Untimed pass: every derived tour is a valid tour from its square
+        Board checkBoard(size, size);
+        Solver checker(checkBoard);
+        bool match = sweepSolved == fullSolved;
+        sweep.run(solver, TourType::OPEN, [&](const SweepResult& result) {
+            if (result.solved) {
+                match = match && result.path.front().row == result.start.row &&
+                        result.path.front().col == result.start.col &&
+                        checker.setSolution(result.path, TourType::OPEN);
+            }
+        });
+        allMatch = allMatch && match;
+
+        std::cout << std::left << std::fixed << std::setprecision(2)
+                  << std::setw(10) << (std::to_string(size) + "x" + std::to_string(size))
+                  << std::setw(10) << board.size()
+                  << std::setw(9) << sweep.orbits().size()
+                  << std::setw(13) << fullMs
+                  << std::setw(13) << sweepMs
+                  << std::setw(10) << (sweepMs > 0.0 ? fullMs / sweepMs : 0.0)
+                  << (match ? "ok" : "MISMATCH")
+                  << "\n";
+    }
+
+    std::cout << "\nSweep time includes transforming every derived tour.\n";
+    std::cout << (allMatch ? "PASS: per-square results match full solves\n" : "FAIL: results differ\n");
+    return allMatch ? 0 : 1;
+}
@@ -0,0 +1,98 @@
+#include "Benchmarks.h"
+#include "Benchmark.h"
+#include "DivideAndConquerSolver.h"
+#include "Exporter.h"
+#include "TourFile.h"
+#include <filesystem>
+#include <random>
+
+int runTourFileBenchmark() {
+    const size_t sizes[] = {100, 1000};
+    const std::filesystem::path directory = std::filesystem::temp_directory_path();
+    const std::string jsonFile = (directory / "knights_tour_format_bench.json").string();
+    const std::string binaryFile = (directory / "knights_tour_format_bench.kt").string();
+
+    std::cout << "\n=== Binary Tour Format (.kt) vs JSON (divide-and-conquer closed tours) ===\n\n";
+    std::cout << std::left
+              << std::setw(11) << "Board"
+              << std::setw(12) << "JSON (KB)"
+              << std::setw(11) << ".kt (KB)"
+              << std::setw(12) << "JSON (ms)"
+              << std::setw(11) << ".kt (ms)"
+              << std::setw(11) << "Open (us)"
+              << std::setw(13) << "move(i) (ns)"
+              << std::setw(13) << "Decode (ms)"
+              << "Check"
+              << "\n";
+    std::cout << std::string(100, '-') << "\n";
+
+    bool allMatch = true;
+    for (size_t size : sizes) {
+        Board board(size, size);
+        Solver solver(board);
+        DivideAndConquerSolver builder(board);
+        bool built = builder.solve(0, 0, TourType::CLOSED) && solver.setSolution(builder.getPath(), TourType::CLOSED);
+        const auto& path = solver.getPath();
+
+        Timer jsonTimer;
+        bool jsonWritten = Exporter::exportToJSON(solver, board, jsonFile);
+        double jsonMs = jsonTimer.elapsedMilliseconds();
+
+        Timer binaryTimer;
+        bool binaryWritten = Exporter::exportToBinary(solver, board, binaryFile);
+        double binaryMs = binaryTimer.elapsedMilliseconds();
+
+        bool match = built && jsonWritten && binaryWritten;
+        double openUs = 0.0;
+        double moveNs = 0.0;
+        double decodeMs = 0.0;
+        if (match) {
+            Timer openTimer;
+            TourReader reader(binaryFile);
+            openUs = static_cast<double>(openTimer.elapsedMicroseconds());
+
+            // Random access across the whole tour
+            constexpr size_t LOOKUPS = 100000;
+            std::mt19937_64 rng(42);
+            std::uniform_int_distribution<size_t> pick(0, path.size() - 1);
+            std::vector<size_t> positions(LOOKUPS);
+            for (auto& position : positions) {
+                position = pick(rng);
+            }
+            bool randomMatch = true;
+            Timer moveTimer;
+            for (size_t position : positions) {
+                const Move square = reader.move(position);
+                randomMatch = randomMatch && square.row == path[position].row && square.col == path[position].col;
+            }
+            moveNs = static_cast<double>(moveTimer.elapsedMicroseconds()) * 1000.0 / LOOKUPS;
+
+            Timer decodeTimer;
+            std::vector<Move> decoded = reader.readAll();
+            decodeMs = decodeTimer.elapsedMilliseconds();
+
+            match = randomMatch && reader.verify() && reader.tourType() == TourType::CLOSED &&
+                    decoded.size() == path.size() &&
+                    std::equal(decoded.begin(), decoded.end(), path.begin(),
+                               [](const Move& a, const Move& b) { return a.row == b.row && a.col == b.col; });
+        }
+        allMatch = allMatch && match;
+
+        std::cout << std::left << std::fixed << std::setprecision(2)
+                  << std::setw(11) << (std::to_string(size) + "x" + std::to_string(size))
+                  << std::setw(12) << static_cast<double>(std::filesystem::file_size(jsonFile)) / 1024.0
+                  << std::setw(11) << static_cast<double>(std::filesystem::file_size(binaryFile)) / 1024.0
+                  << std::setw(12) << jsonMs
+                  << std::setw(11) << binaryMs
+                  << std::setw(11) << openUs
+                  << std::setw(13) << moveNs
+                  << std::setw(13) << decodeMs
+                  << (match ? "ok" : "MISMATCH")
+                  << "\n";
+    }
+
+    std::filesystem::remove(jsonFile);
+    std::filesystem::remove(binaryFile);
+    std::cout << "\n" << (allMatch ? "PASS: .kt files round-trip exactly\n" : "FAIL: .kt round trip differs\n");
+    return allMatch ? 0 : 1;
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "Solver.h"
+#include "SolverWorkspace.h"
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+class OutputBuffer;
+class SolverPool;
+
+/**
+ * @brief How a batch job's result is written
+ */
+enum class BatchFormat {
+    JSON,     // One JSON object per line (NDJSON)
+    BINARY    // One .kt record (see TourFile)
+};
+
+/**
+ * @brief One solve request of a batch
+ *
+ * Written as one line of whitespace-separated key=value fields, e.g.
+ *
+ *     size=8 start=0,0 type=closed format=json id=a1
+ *     width=6 height=5 start=2,3 algo=divide
+ *
+ * Keys: size (square board), width, height, start (R,C), type (open|closed),
+ * format (json|kt), algo (warnsdorff|divide), id (echoed in JSON results),
+ * timeout (milliseconds), budget (most backtracks).
+ * Omitted keys take the defaults of SolveJob and below.
+ */
+struct BatchJob : SolveJob {
+    BatchFormat format = BatchFormat::JSON;
+    std::string id;
+};
+
+/**
+ * @brief Runs a stream of solve requests in one process
+ *
+ * Jobs are read one per line; blank lines and lines starting with '#' are
+ * skipped. With one thread, jobs are solved in turn on a SolverWorkspace,
+ * so a long batch allocates a board only when it sees a new size. With
+ * more, they are handed to a SolverPool and results are written back in
+ * job order as they complete.
+ *
+ * Results are written in job order:
+ *  - JSON: {"id", "width", "height", "start", "type", "solved", "status",
+ *    "backtracks", "micros", "path": [[row, col], ...]} on one line, where
+ *    status is a solveStatusName()
+ *  - BINARY: the bytes of a .kt file. A job without a tour is written as a
+ *    header with moveCount 0 and blockCount 0, so every record's length
+ *    follows from its header.
+ *
+ * Output is buffered and flushed whenever the input has nothing more
+ * buffered, so results stream out while a producer is still writing jobs.
+ * For interactive input (the default: a pipe or terminal whose producer
+ * may wait for answers before writing more jobs) every pending result is
+ * written at that point too. For file input (setInteractive(false)) only
+ * the finished ones are, so the pool stays full across buffer refills.
+ * Lines that do not parse are reported to the error stream and skipped.
+ */
+class BatchRunner {
+public:
+    /**
+     * @brief Create a runner
+     * @param defaultFormat Format of jobs that do not name one
+     * @param threadCount Solver threads (1 = solve on the calling thread, 0 = hardware concurrency)
+     */
+    explicit BatchRunner(BatchFormat defaultFormat = BatchFormat::JSON, size_t threadCount = 1);
+
+    ~BatchRunner();
+
+    /**
+     * @brief Parse one job line
+     * @param line Job spec (key=value fields)
+     * @param defaultFormat Format if the line does not name one
+     * @return The job
+     * @throws std::invalid_argument if a field is unknown or out of range
+     */
+    [[nodiscard]] static BatchJob parseJob(const std::string& line, BatchFormat defaultFormat = BatchFormat::JSON);
+
+    /**
+     * @brief Read jobs until end of input, writing each result
+     * @param in Job lines
+     * @param out Results
+     * @param errors Receives one message per rejected line
+     * @return Number of rejected lines
+     */
+    size_t run(std::istream& in, std::ostream& out, std::ostream& errors);
+
+    /**
+     * @brief Solve one job on the calling thread and write its result
+     * @param job Job to solve (must pass SolverWorkspace::validate)
+     * @param out Receives the result record
+     * @return true if a tour was found
+     */
+    bool process(const BatchJob& job, OutputBuffer& out);
+
+    /**
+     * @brief Write one result record in the job's format
+     * @param job The job (its format and id are used)
+     * @param status How the solve ended
+     * @param path The tour (ignored unless SOLVED)
+     * @param backtracks Backtracks of the solve
+     * @param micros Solve time (JSON only)
+     * @param out Receives the record
+     */
+    static void writeResult(const BatchJob& job, SolveStatus status, const std::vector<Move>& path, size_t backtracks,
+                            int64_t micros, OutputBuffer& out);
+
+    /**
+     * @brief Set the time limit of jobs that do not give one
+     * @param millis Milliseconds per Warnsdorff solve (0 = none)
+     */
+    void setDefaultTimeout(int64_t millis) { defaultTimeoutMillis_ = millis; }
+
+    /**
+     * @brief Set whether to wait for every pending result when the input runs dry
+     * @param interactive true if the producer may wait on answers (default), false for files
+     */
+    void setInteractive(bool interactive) { interactive_ = interactive; }
+
+    /**
+     * @brief Get number of jobs solved so far (found a tour or not)
+     */
+    [[nodiscard]] size_t getJobCount() const { return jobCount_; }
+
+    /**
+     * @brief Get number of jobs that found a tour
+     */
+    [[nodiscard]] size_t getSolvedCount() const { return solvedCount_; }
+
+    /**
+     * @brief Get number of Board/Solver pairs allocated, over all threads
+     */
+    [[nodiscard]] size_t getBoardAllocations() const;
+
+    /**
+     * @brief Get the number of solver threads
+     */
+    [[nodiscard]] size_t getThreadCount() const;
+
+private:
+    BatchFormat defaultFormat_;
+    SolverWorkspace workspace_;
+    std::unique_ptr<SolverPool> pool_;  // Only with more than one thread
+    size_t jobCount_;
+    size_t solvedCount_;
+    int64_t defaultTimeoutMillis_;
+    bool interactive_;
+
+    void write(const BatchJob& job, SolveStatus status, const std::vector<Move>& path, size_t backtracks,
+               int64_t micros, OutputBuffer& out);
+
+    static void writeJSON(const BatchJob& job, SolveStatus status, const std::vector<Move>& path, size_t backtracks,
+                          int64_t micros, OutputBuffer& out);
+    static void writeBinary(const BatchJob& job, SolveStatus status, const std::vector<Move>& path, size_t backtracks,
+                            OutputBuffer& out);
+};
@@ -238,13 +238,13 @@ public:
             std::cout << "Running benchmark: " << name << " [" << iterations_ << " iterations]\n";
         }
 
+        // One board and solver for every run: a solve resets all solver state
+        Board board(boardSize, boardSize);
+        Solver solver(board);
+
         // Warmup runs
-        if (warmupRuns_ > 0) {
-            for (size_t i = 0; i < warmupRuns_; ++i) {
-                Board warmupBoard(boardSize, boardSize);
-                Solver warmupSolver(warmupBoard);
-                warmupSolver.solve(startRow, startCol, tourType);
-            }
+        for (size_t i = 0; i < warmupRuns_; ++i) {
+            solver.solve(startRow, startCol, tourType);
         }
 
         // Actual benchmark runs
@@ -253,9 +253,6 @@ public:
         size_t successes = 0;
 
         for (size_t i = 0; i < iterations_; ++i) {
-            Board board(boardSize, boardSize);
-            Solver solver(board);
-
             Timer timer;
             bool solved = solver.solve(startRow, startCol, tourType);
             long long elapsed = timer.elapsedMicroseconds();
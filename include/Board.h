@@ -2,6 +2,9 @@
 
 #include <vector>
 #include <cstddef>
+#include <cstdint>
+#include <array>
+#include <memory>
 #include <stdexcept>
 
 /**
@@ -12,14 +15,77 @@ struct Move {
     int col;
 };
 
+/**
+ * @brief Fixed-capacity list stored inline (never allocates)
+ *
+ * A knight has at most 8 moves from any square, so move lists in the solver
+ * hot path can live entirely on the stack.
+ */
+template<typename T, size_t Capacity>
+class StaticList {
+public:
+    void push_back(const T& value) noexcept { items_[count_++] = value; }
+    void clear() noexcept { count_ = 0; }
+
+    [[nodiscard]] size_t size() const noexcept { return count_; }
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return Capacity; }
+
+    [[nodiscard]] T& operator[](size_t i) noexcept { return items_[i]; }
+    [[nodiscard]] const T& operator[](size_t i) const noexcept { return items_[i]; }
+
+    [[nodiscard]] T* begin() noexcept { return items_.data(); }
+    [[nodiscard]] T* end() noexcept { return items_.data() + count_; }
+    [[nodiscard]] const T* begin() const noexcept { return items_.data(); }
+    [[nodiscard]] const T* end() const noexcept { return items_.data() + count_; }
+
+private:
+    std::array<T, Capacity> items_;
+    size_t count_ = 0;
+};
+
+// Knight moves from one square (row/col form)
+using StaticMoveList = StaticList<Move, 8>;
+
+// Knight moves from one square (square index form, used by the solver)
+using StaticSquareList = StaticList<uint32_t, 8>;
+
+class KnightGraph;
+
 /**
  * @brief Represents a chessboard for the Knight's Tour problem
  *
  * The board uses a 1D vector for efficient memory layout and cache performance.
  * Each square stores the move number (1-indexed), with 0 indicating unvisited.
+ *
+ * The squares are stored inside a 2-cell sentinel border (row stride
+ * width + 4) whose cells are permanently marked visited. A knight move from
+ * any square then lands either on the board or on the border, so each of the
+ * 8 moves is a fixed offset in the cell array and move generation needs no
+ * bounds checks: an off-board target simply reads as visited. The cell API
+ * (cellIndex, knightOffsets, isVisitedCell, setByCell) exposes this layout to
+ * the solver; the row/column and square-index APIs are unchanged.
+ *
+ * The cells are the board's only state. The solver searches on its own
+ * visited bitset and degree map and writes the tour here once at the end,
+ * so every write is a single store.
  */
 class Board {
 public:
+    // Knight move offsets (L-shaped: 2 squares in one direction, 1 in perpendicular)
+    static constexpr Move KNIGHT_MOVES[8] = {
+        {-2, -1}, {-2, +1},  // Up-left, up-right
+        {-1, -2}, {-1, +2},  // Left-up, right-up
+        {+1, -2}, {+1, +2},  // Left-down, right-down
+        {+2, -1}, {+2, +1}   // Down-left, down-right
+    };
+
+    // Width of the sentinel border around the board (a knight jumps at most 2)
+    static constexpr int BORDER = 2;
+
+    // Cell value of border squares (reads as visited)
+    static constexpr int SENTINEL = -1;
+
     /**
      * @brief Construct a board of given dimensions
      * @param width Board width (number of columns)
@@ -112,6 +178,15 @@ public:
      */
     [[nodiscard]] std::vector<Move> getValidMoves(int row, int col, bool onlyUnvisited = true) const;
 
+    /**
+     * @brief Get all valid knight moves from a position without allocating
+     * @param row Current row
+     * @param col Current column
+     * @param moves Output list (cleared first)
+     * @param onlyUnvisited If true, only return unvisited squares
+     */
+    void getValidMoves(int row, int col, StaticMoveList& moves, bool onlyUnvisited = true) const;
+
     /**
      * @brief Count number of valid knight moves from a position
      * @param row Current row
@@ -120,17 +195,96 @@ public:
      */
     [[nodiscard]] int countValidMoves(int row, int col) const;
 
+    /**
+     * @brief Get the shared knight adjacency table for this board's dimensions
+     *
+     * Only divide-and-conquer and tour counting need neighbor lists; move
+     * generation uses the padded cells. Built (or taken from KnightGraph's
+     * cache) on the first call, so boards like the solver's never hold one.
+     * Like the rest of Board, not safe to call from several threads at once.
+     *
+     * @return Knight graph (CSR neighbor lists)
+     */
+    [[nodiscard]] const KnightGraph& graph() const;
+
+    /**
+     * @brief Check if a square has been visited, by 1D index
+     * @param index Square index (row * width + col), must be in range
+     * @return true if square has been visited
+     */
+    [[nodiscard]] bool isVisitedIndex(size_t index) const noexcept { return cells_[cellOfIndex(index)] != 0; }
+
+    /**
+     * @brief Set move number of a square, by 1D index (no bounds check)
+     * @param index Square index (row * width + col), must be in range
+     * @param moveNumber Move number to set (0 = unvisited)
+     */
+    void setByIndex(size_t index, int moveNumber) noexcept { cells_[cellOfIndex(index)] = moveNumber; }
+
+    /**
+     * @brief Get the row stride of the padded cell array
+     * @return width + 2 * BORDER
+     */
+    [[nodiscard]] size_t stride() const noexcept { return stride_; }
+
+    /**
+     * @brief Get the size of the padded cell array (board plus border)
+     * @return Number of cells
+     */
+    [[nodiscard]] size_t cellCount() const noexcept { return cells_.size(); }
+
+    /**
+     * @brief Convert 2D coordinates to a padded cell index (no bounds check)
+     * @param row Row coordinate, must be valid
+     * @param col Column coordinate, must be valid
+     * @return Cell index
+     */
+    [[nodiscard]] size_t cellIndex(int row, int col) const noexcept {
+        return static_cast<size_t>(row + BORDER) * stride_ + static_cast<size_t>(col + BORDER);
+    }
+
+    /**
+     * @brief Convert a padded cell index back to 2D coordinates
+     * @param cell Cell index of a board square
+     * @return Square coordinates
+     */
+    [[nodiscard]] Move cellToMove(size_t cell) const noexcept {
+        return {static_cast<int>(cell / stride_) - BORDER, static_cast<int>(cell % stride_) - BORDER};
+    }
+
+    /**
+     * @brief Get the cell index offsets of the 8 knight moves, in KNIGHT_MOVES order
+     *
+     * Adding an offset to the cell of any board square gives a valid cell:
+     * the target square, or a sentinel if the move leaves the board. The
+     * offsets are ascending, so iterating them visits targets in the same
+     * (ascending) order as KnightGraph neighbor lists.
+     *
+     * @return Offsets, one per knight move
+     */
+    [[nodiscard]] const std::array<ptrdiff_t, 8>& knightOffsets() const noexcept { return knightOffsets_; }
+
+    /**
+     * @brief Check if a cell is visited (border cells always are)
+     * @param cell Cell index, must be in range
+     * @return true if the cell is visited or a border cell
+     */
+    [[nodiscard]] bool isVisitedCell(size_t cell) const noexcept { return cells_[cell] != 0; }
+
+    /**
+     * @brief Set move number of a board square, by cell index (no bounds check)
+     * @param cell Cell index of a board square
+     * @param moveNumber Move number to set (0 = unvisited)
+     */
+    void setByCell(size_t cell, int moveNumber) noexcept { cells_[cell] = moveNumber; }
+
 private:
-    // Knight move offsets (L-shaped: 2 squares in one direction, 1 in perpendicular)
-    static constexpr Move KNIGHT_MOVES[8] = {
-        {-2, -1}, {-2, +1},  // Up-left, up-right
-        {-1, -2}, {-1, +2},  // Left-up, right-up
-        {+1, -2}, {+1, +2},  // Left-down, right-down
-        {+2, -1}, {+2, +1}   // Down-left, down-right
-    };
     size_t width_;
     size_t height_;
-    std::vector<int> board_;
+    size_t stride_;                             // Row stride of cells_ (width + 2 * BORDER)
+    std::vector<int> cells_;                    // Move numbers inside a SENTINEL border
+    std::array<ptrdiff_t, 8> knightOffsets_;    // Cell offsets of the knight moves
+    mutable std::shared_ptr<const KnightGraph> graph_;  // Shared adjacency table (set by graph())
 
     /**
      * @brief Convert 2D coordinates to 1D index
@@ -139,4 +293,13 @@ private:
      * @return 1D index in the board vector
      */
     [[nodiscard]] size_t toIndex(int row, int col) const noexcept;
+
+    /**
+     * @brief Convert a square index (row * width + col) to its cell index
+     * @param index Square index, must be in range
+     * @return Cell index
+     */
+    [[nodiscard]] size_t cellOfIndex(size_t index) const noexcept {
+        return index + (index / width_) * 2 * BORDER + BORDER * stride_ + BORDER;
+    }
 };
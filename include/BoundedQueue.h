@@ -0,0 +1,88 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+/**
+ * @brief Bounded multi-producer, multi-consumer FIFO queue
+ *
+ * push() blocks while the queue is full and pop() while it is empty, so a
+ * fast producer cannot run ahead of the consumers by more than the
+ * capacity. close() wakes everyone: later pushes fail and pop() returns
+ * std::nullopt once the remaining items are drained.
+ *
+ * @tparam T Item type (movable)
+ */
+template<typename T>
+class BoundedQueue {
+public:
+    /**
+     * @brief Create a queue
+     * @param capacity Most items held at once (at least 1)
+     */
+    explicit BoundedQueue(size_t capacity) : capacity_(capacity > 0 ? capacity : 1), closed_(false) {}
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    /**
+     * @brief Add an item, waiting for room
+     * @return false if the queue was closed (the item is dropped)
+     */
+    bool push(T item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notFull_.wait(lock, [this] { return closed_ || items_.size() < capacity_; });
+        if (closed_) {
+            return false;
+        }
+        items_.push_back(std::move(item));
+        lock.unlock();
+        notEmpty_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Take the oldest item, waiting for one
+     * @return The item, or std::nullopt if the queue is closed and empty
+     */
+    std::optional<T> pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notEmpty_.wait(lock, [this] { return closed_ || !items_.empty(); });
+        if (items_.empty()) {
+            return std::nullopt;
+        }
+        T item = std::move(items_.front());
+        items_.pop_front();
+        lock.unlock();
+        notFull_.notify_one();
+        return item;
+    }
+
+    /**
+     * @brief Refuse new items and wake all waiting threads
+     */
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        notFull_.notify_all();
+        notEmpty_.notify_all();
+    }
+
+    /**
+     * @brief Get the capacity
+     */
+    [[nodiscard]] size_t capacity() const { return capacity_; }
+
+private:
+    const size_t capacity_;
+    std::mutex mutex_;
+    std::condition_variable notFull_;
+    std::condition_variable notEmpty_;
+    std::deque<T> items_;
+    bool closed_;
+};
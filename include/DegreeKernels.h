@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/**
+ * @brief Data-parallel kernels over the solver's padded degree map
+ *
+ * The degree map holds one byte per padded board cell (see Board::cellIndex):
+ *  - unvisited board cell: number of unvisited knight neighbors (0-8)
+ *  - visited board cell: that count plus VISITED_FLAG
+ *  - border cell: BORDER_DEGREE, less one per visited neighbor when the map
+ *    is updated incrementally (never below BORDER_DEGREE - 8)
+ *
+ * Only unvisited board cells can read exactly 1, so "some neighbor would be
+ * isolated" is a test for a byte equal to 1, with no visited lookups.
+ *
+ * The whole-board pass has an AVX2 kernel, selected at runtime when the CPU
+ * supports it, and a portable fallback that computes the same bytes 8 cells
+ * at a time in 64-bit words.
+ */
+class DegreeKernels {
+public:
+    /**
+     * @brief Instruction set used by computeDegreeMap
+     */
+    enum class Isa {
+        SCALAR,   // Portable 64-bit code, 8 cells per step
+        AVX2      // 32 cells per step
+    };
+
+    // Added to the degree of a visited cell (keeps it away from 0 and 1)
+    static constexpr uint8_t VISITED_FLAG = 0x40;
+
+    // Degree of a border cell with no visited neighbors (at most 8 are subtracted)
+    static constexpr uint8_t BORDER_DEGREE = 0xC0;
+
+    /**
+     * @brief Best instruction set supported by this CPU (detected once)
+     * @return AVX2 when available, SCALAR otherwise
+     */
+    [[nodiscard]] static Isa activeIsa();
+
+    /**
+     * @brief Number of 64-bit words a padded visited bitset must have
+     *
+     * computeDegreeMap reads whole words past the last cell, so bitsets get
+     * one word of slack beyond cellCount bits.
+     *
+     * @param cellCount Number of padded cells
+     */
+    [[nodiscard]] static constexpr size_t bitsetWords(size_t cellCount) {
+        return cellCount / 64 + 2;
+    }
+
+    /**
+     * @brief Compute the degree map of a whole board from its visited bits
+     * @param visited Padded visited bitset, bitsetWords(cellCount) words, border bits set
+     * @param width Board width
+     * @param height Board height
+     * @param degree Output degree map, one byte per padded cell (resized if needed)
+     * @param isa Kernel to use (default: activeIsa())
+     */
+    static void computeDegreeMap(const std::vector<uint64_t>& visited, size_t width, size_t height,
+                                 std::vector<uint8_t>& degree, Isa isa = activeIsa());
+
+    /**
+     * @brief Check whether any knight neighbor of a cell has degree exactly 1
+     *
+     * Loads the 8 neighbor degrees into one 64-bit word and tests all bytes
+     * at once. Called on an unvisited candidate square, this says whether
+     * moving there would leave some unvisited square with no moves.
+     *
+     * @param degree Degree map
+     * @param cell Padded cell index
+     * @param offsets Cell offsets of the knight moves (Board::knightOffsets())
+     * @return true if a neighbor's degree is 1
+     */
+    [[nodiscard]] static bool anyNeighborAtOne(const uint8_t* degree, size_t cell,
+                                               const std::array<ptrdiff_t, 8>& offsets) noexcept {
+        uint8_t bytes[8];
+        for (size_t k = 0; k < 8; ++k) {
+            bytes[k] = degree[cell + offsets[k]];
+        }
+        uint64_t word;
+        std::memcpy(&word, bytes, sizeof(word));
+
+        // Bytes equal to 1 become 0; then the classic zero-byte test
+        constexpr uint64_t ONES = 0x0101010101010101ULL;
+        constexpr uint64_t HIGHS = 0x8080808080808080ULL;
+        const uint64_t x = word ^ ONES;
+        return ((x - ONES) & ~x & HIGHS) != 0;
+    }
+};
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Board.h"
+#include "Solver.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Builds closed knight's tours on large boards by divide and conquer
+ *
+ * Parberry-style construction: the board is tiled with blocks between 5x5
+ * and 10x10 whose closed tours are precomputed, and the block tours are
+ * stitched into a single closed tour. The construction runs in O(width *
+ * height) time with no search, so million-square tours take milliseconds.
+ *
+ * Every precomputed block tour is "structured": besides the two moves forced
+ * at each corner, it contains the moves (1,w-2)-(3,w-1) near its top-right
+ * corner and (h-2,1)-(h-1,3) near its bottom-left corner. Two neighboring
+ * tours are joined by deleting one such move from each and adding the two
+ * knight moves that cross the seam between them:
+ * - left/right neighbors in the top block row: the left block's (1,w-2)-(3,w-1)
+ *   move and the right block's forced (0,0)-(2,1) move
+ * - upper/lower neighbors in a block column: the upper block's (h-2,1)-(h-1,3)
+ *   move and the lower block's forced (0,0)-(1,2) move
+ * Each move is used by at most one join, and the joins form a spanning tree
+ * of the blocks, so the result is one cycle covering the board.
+ *
+ * A closed tour exists on a board with both sides at least 5 if and only if
+ * its area is even (Schwenk), and this construction covers exactly those
+ * boards. Since a closed tour is also an open one, the result serves both
+ * tour types from any starting square.
+ */
+class DivideAndConquerSolver {
+public:
+    /**
+     * @brief Construct a solver for the given board
+     * @param board Reference to the board to fill
+     */
+    explicit DivideAndConquerSolver(Board& board);
+
+    /**
+     * @brief Check if the construction applies to a board size
+     * @param width Board width
+     * @param height Board height
+     * @return true if both sides are at least 5 and the area is even
+     */
+    [[nodiscard]] static bool supports(size_t width, size_t height) noexcept;
+
+    /**
+     * @brief Build a closed tour and rotate it to begin at the start square
+     * @param startRow Starting row position (default 0)
+     * @param startCol Starting column position (default 0)
+     * @param type Tour type (both are satisfied by the closed tour)
+     * @return true if a tour was built, false if the board is unsupported
+     */
+    bool solve(int startRow = 0, int startCol = 0, TourType type = TourType::OPEN);
+
+    /**
+     * @brief Get the solution path (sequence of moves)
+     * @return Vector of moves representing the solution
+     */
+    [[nodiscard]] const std::vector<Move>& getPath() const { return path_; }
+
+private:
+    Board& board_;
+    std::vector<Move> path_;
+    std::vector<std::array<uint32_t, 2>> links_;   // The two tour neighbors of every square
+
+    /**
+     * @brief Split a board side into block lengths between 5 and 10
+     * @param length Board side (>= 5)
+     * @return Block lengths; at most one is odd
+     */
+    [[nodiscard]] static std::vector<size_t> splitSide(size_t length);
+
+    /**
+     * @brief Copy the precomputed tour of one block into links_
+     * @param row Top row of the block
+     * @param col Left column of the block
+     * @param width Block width
+     * @param height Block height
+     */
+    void placeBlock(size_t row, size_t col, size_t width, size_t height);
+
+    /**
+     * @brief Join two cycles by exchanging a pair of parallel moves
+     *
+     * Removes moves a-b and c-d and adds a-c and b-d.
+     */
+    void join(uint32_t a, uint32_t b, uint32_t c, uint32_t d);
+
+    /**
+     * @brief Replace one tour neighbor of a square
+     */
+    void relink(uint32_t square, uint32_t from, uint32_t to);
+};
@@ -5,11 +5,25 @@
 #include <string>
 #include <fstream>
 
+class OutputBuffer;
+
 /**
  * @brief Export knight's tour solutions to various file formats
  */
 class Exporter {
 public:
+    // Largest board (in squares) whose level-of-detail SVG still gets move labels
+    static constexpr size_t DEFAULT_SVG_LABEL_LIMIT = 400;
+
+    // Longest side, in pixels, of the displayed level-of-detail SVG
+    static constexpr int MAX_SVG_DISPLAY_SIZE = 2048;
+
+    // Longest side, in pixels, of a PNG export (cells are at least 2 pixels)
+    static constexpr size_t MAX_PNG_SIZE = 2048;
+
+    // Largest cell, in pixels, of a PNG export
+    static constexpr size_t MAX_PNG_CELL_SIZE = 48;
+
     /**
      * @brief Export solution to JSON format
      * @param solver Solver containing the solution
@@ -28,6 +42,41 @@ public:
      */
     static bool exportToSVG(const Solver& solver, const Board& board, const std::string& filename);
 
+    /**
+     * @brief Export solution to a level-of-detail SVG for large boards
+     *
+     * Same picture as exportToSVG, but the checkerboard is one rectangle
+     * filled with a 2x2 <pattern>, the path is a single <path> of relative
+     * moves, and the per-square circles and move numbers are only drawn on
+     * boards of at most labelLimit squares. A 1000x1000 tour takes about 8 MB
+     * instead of about 320 MB. The drawing is scaled to at most
+     * MAX_SVG_DISPLAY_SIZE pixels.
+     *
+     * @param solver Solver containing the solution
+     * @param board Board with the solution
+     * @param filename Output filename
+     * @param labelLimit Largest board size (squares) that gets move labels
+     * @return true if export successful
+     */
+    static bool exportToSVGLevelOfDetail(const Solver& solver, const Board& board, const std::string& filename,
+                                         size_t labelLimit = DEFAULT_SVG_LABEL_LIMIT);
+
+    /**
+     * @brief Export solution to a PNG image
+     *
+     * Rasterizes the checkerboard and the path straight into an RGBA buffer
+     * and encodes it with PngWriter. Cells are as large as fits in
+     * MAX_PNG_SIZE pixels (between 2 and MAX_PNG_CELL_SIZE). The path is
+     * colored by move index, from green at the start to red at the end; the
+     * start and end squares are marked in those colors.
+     *
+     * @param solver Solver containing the solution
+     * @param board Board with the solution
+     * @param filename Output filename
+     * @return true if export successful
+     */
+    static bool exportToPNG(const Solver& solver, const Board& board, const std::string& filename);
+
     /**
      * @brief Export solution to plain text format
      * @param solver Solver containing the solution
@@ -37,7 +86,26 @@ public:
      */
     static bool exportToText(const Solver& solver, const Board& board, const std::string& filename);
 
+    /**
+     * @brief Export solution to the binary .kt format (see TourFile)
+     * @param solver Solver containing the solution
+     * @param board Board with the solution
+     * @param filename Output filename
+     * @return true if export successful
+     */
+    static bool exportToBinary(const Solver& solver, const Board& board, const std::string& filename);
+
 private:
+    /**
+     * @brief Write the circle and move number of every square
+     */
+    static void writeSVGLabels(OutputBuffer& out, const std::vector<Move>& path, int cellSize, int padding);
+
+    /**
+     * @brief Write the start/end legend at the bottom of the drawing
+     */
+    static void writeSVGLegend(OutputBuffer& out, int height);
+
     /**
      * @brief Escape special characters for JSON strings
      * @param str String to escape
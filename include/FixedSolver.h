@@ -0,0 +1,350 @@
+#pragma once
+
+#include "Board.h"
+#include "Solver.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Board with compile-time dimensions
+ *
+ * Same padded layout as Board (2-cell SENTINEL border, row stride W + 4),
+ * but the cell array is a std::array and the knight offsets, initial
+ * degrees and center distances are constexpr tables, so the compiler sees
+ * every index computation as constants.
+ *
+ * @tparam W Board width
+ * @tparam H Board height
+ */
+template<size_t W, size_t H>
+class FixedBoard {
+public:
+    static_assert(W > 0 && H > 0, "Board dimensions must be positive");
+
+    static constexpr size_t WIDTH = W;
+    static constexpr size_t HEIGHT = H;
+    static constexpr size_t SIZE = W * H;
+    static constexpr size_t STRIDE = W + 2 * Board::BORDER;
+    static constexpr size_t CELLS = STRIDE * (H + 2 * Board::BORDER);
+
+    // Cell offsets of the knight moves, in KNIGHT_MOVES order (ascending)
+    static constexpr std::array<ptrdiff_t, 8> OFFSETS = [] {
+        std::array<ptrdiff_t, 8> offsets{};
+        for (size_t i = 0; i < 8; ++i) {
+            offsets[i] = Board::KNIGHT_MOVES[i].row * static_cast<ptrdiff_t>(STRIDE) + Board::KNIGHT_MOVES[i].col;
+        }
+        return offsets;
+    }();
+
+    /**
+     * @brief Convert 2D coordinates to a cell index (no bounds check)
+     */
+    [[nodiscard]] static constexpr size_t cellIndex(int row, int col) noexcept {
+        return static_cast<size_t>(row + Board::BORDER) * STRIDE + static_cast<size_t>(col + Board::BORDER);
+    }
+
+    /**
+     * @brief Convert a cell index back to 2D coordinates
+     */
+    [[nodiscard]] static constexpr Move cellToMove(size_t cell) noexcept {
+        return {static_cast<int>(cell / STRIDE) - Board::BORDER, static_cast<int>(cell % STRIDE) - Board::BORDER};
+    }
+
+    /**
+     * @brief Check if coordinates are within board bounds
+     */
+    [[nodiscard]] static constexpr bool isValid(int row, int col) noexcept {
+        return row >= 0 && row < static_cast<int>(H) && col >= 0 && col < static_cast<int>(W);
+    }
+
+    // Empty board: SENTINEL border, 0 on the board
+    static constexpr std::array<int, CELLS> EMPTY_CELLS = [] {
+        std::array<int, CELLS> cells{};
+        cells.fill(Board::SENTINEL);
+        for (int row = 0; row < static_cast<int>(H); ++row) {
+            for (int col = 0; col < static_cast<int>(W); ++col) {
+                cells[cellIndex(row, col)] = 0;
+            }
+        }
+        return cells;
+    }();
+
+    // Degree of every cell on the empty board (0 on the border)
+    static constexpr std::array<uint8_t, CELLS> INITIAL_DEGREES = [] {
+        std::array<uint8_t, CELLS> degrees{};
+        for (int row = 0; row < static_cast<int>(H); ++row) {
+            for (int col = 0; col < static_cast<int>(W); ++col) {
+                uint8_t degree = 0;
+                for (const auto& move : Board::KNIGHT_MOVES) {
+                    degree += isValid(row + move.row, col + move.col) ? 1 : 0;
+                }
+                degrees[cellIndex(row, col)] = degree;
+            }
+        }
+        return degrees;
+    }();
+
+    // Manhattan distance of every cell from the board center (Solver's tie-break)
+    static constexpr std::array<uint16_t, CELLS> CENTER_DISTANCES = [] {
+        std::array<uint16_t, CELLS> distances{};
+        const int centerRow = static_cast<int>(H) / 2;
+        const int centerCol = static_cast<int>(W) / 2;
+        for (int row = 0; row < static_cast<int>(H); ++row) {
+            for (int col = 0; col < static_cast<int>(W); ++col) {
+                int dr = row > centerRow ? row - centerRow : centerRow - row;
+                int dc = col > centerCol ? col - centerCol : centerCol - col;
+                distances[cellIndex(row, col)] = static_cast<uint16_t>(dr + dc);
+            }
+        }
+        return distances;
+    }();
+
+    FixedBoard() noexcept : cells_(EMPTY_CELLS) {}
+
+    /**
+     * @brief Reset all squares to unvisited
+     */
+    void clear() noexcept { cells_ = EMPTY_CELLS; }
+
+    /**
+     * @brief Get move number of a cell (0 = unvisited, SENTINEL = border)
+     */
+    [[nodiscard]] int cell(size_t index) const noexcept { return cells_[index]; }
+
+    /**
+     * @brief Check if a cell is visited (border cells always are)
+     */
+    [[nodiscard]] bool isVisitedCell(size_t index) const noexcept { return cells_[index] != 0; }
+
+    /**
+     * @brief Set move number of a board cell
+     */
+    void setByCell(size_t index, int moveNumber) noexcept { cells_[index] = moveNumber; }
+
+private:
+    std::array<int, CELLS> cells_;
+};
+
+/**
+ * @brief Warnsdorff backtracking solver for a compile-time board size
+ *
+ * Runs exactly the search of Solver with its default settings (iterative
+ * engine, CENTER_FAR tie-break, same dead-end pruning), so it finds the same
+ * tour with the same backtrack count. All state lives in fixed-size arrays
+ * and the 8-move loops are unrolled at compile time.
+ *
+ * Use solveSpecialized() to route a runtime size to an instantiation.
+ *
+ * @tparam W Board width
+ * @tparam H Board height
+ */
+template<size_t W, size_t H>
+class FixedSolver {
+public:
+    using BoardType = FixedBoard<W, H>;
+
+    FixedSolver() noexcept = default;
+
+    /**
+     * @brief Solve the Knight's Tour problem
+     * @param startRow Starting row position (default 0)
+     * @param startCol Starting column position (default 0)
+     * @param type Tour type: OPEN or CLOSED (default OPEN)
+     * @return true if solution found, false otherwise
+     */
+    bool solve(int startRow = 0, int startCol = 0, TourType type = TourType::OPEN) noexcept {
+        pathLength_ = 0;
+        backtrackCount_ = 0;
+        if (!BoardType::isValid(startRow, startCol)) {
+            return false;
+        }
+
+        board_.clear();
+        degree_ = BoardType::INITIAL_DEGREES;
+        tourType_ = type;
+        startCell_ = static_cast<uint16_t>(BoardType::cellIndex(startRow, startCol));
+
+        makeMove(startCell_, 1);
+        return search(startCell_, 2);
+    }
+
+    /**
+     * @brief Get the solution path (sequence of moves)
+     * @return Moves of the last tour found
+     */
+    [[nodiscard]] std::vector<Move> getPath() const {
+        std::vector<Move> path;
+        path.reserve(pathLength_);
+        for (size_t i = 0; i < pathLength_; ++i) {
+            path.push_back(BoardType::cellToMove(path_[i]));
+        }
+        return path;
+    }
+
+    /**
+     * @brief Get number of backtracks performed during solve
+     * @return Total number of times the algorithm backtracked
+     */
+    [[nodiscard]] size_t getBacktrackCount() const noexcept { return backtrackCount_; }
+
+    /**
+     * @brief Get the board (move numbers of the last solve)
+     */
+    [[nodiscard]] const BoardType& board() const noexcept { return board_; }
+
+private:
+    struct SearchFrame {
+        uint16_t square;     // Cell the knight stands on at this depth
+        uint8_t count;       // Number of ordered candidates
+        uint8_t cursor;      // Next candidate to try
+        uint8_t slots[8];    // Candidate knight moves, best first
+    };
+
+    static constexpr auto& OFFSETS = BoardType::OFFSETS;
+
+    // Call fn(integral_constant<size_t, K>) for K = 0..7, fully unrolled
+    template<typename Fn>
+    static void forEachMove(Fn&& fn) {
+        [&]<size_t... K>(std::index_sequence<K...>) {
+            (fn(std::integral_constant<size_t, K>{}), ...);
+        }(std::make_index_sequence<8>{});
+    }
+
+    // Call pred(integral_constant<size_t, K>) for K = 0..7 until one returns true
+    template<typename Pred>
+    static bool anyMove(Pred&& pred) {
+        return [&]<size_t... K>(std::index_sequence<K...>) {
+            return (pred(std::integral_constant<size_t, K>{}) || ...);
+        }(std::make_index_sequence<8>{});
+    }
+
+    BoardType board_;
+    std::array<uint8_t, BoardType::CELLS> degree_{};
+    std::array<uint16_t, BoardType::SIZE> path_{};
+    std::array<SearchFrame, BoardType::SIZE> frames_{};
+    size_t pathLength_ = 0;
+    size_t backtrackCount_ = 0;
+    TourType tourType_ = TourType::OPEN;
+    uint16_t startCell_ = 0;
+
+    void makeMove(size_t cell, int moveNumber) noexcept {
+        board_.setByCell(cell, moveNumber);
+        path_[pathLength_++] = static_cast<uint16_t>(cell);
+        forEachMove([&](auto k) { --degree_[cell + OFFSETS[k]]; });
+    }
+
+    void unmakeMove(size_t cell) noexcept {
+        board_.setByCell(cell, 0);
+        --pathLength_;
+        forEachMove([&](auto k) { ++degree_[cell + OFFSETS[k]]; });
+    }
+
+    [[nodiscard]] bool isSolution(int moveNumber) const noexcept {
+        if (moveNumber != static_cast<int>(BoardType::SIZE) + 1) {
+            return false;
+        }
+        if (tourType_ == TourType::OPEN) {
+            return true;
+        }
+        const auto step = static_cast<ptrdiff_t>(startCell_) - static_cast<ptrdiff_t>(path_[pathLength_ - 1]);
+        return anyMove([&](auto k) { return OFFSETS[k] == step; });
+    }
+
+    [[nodiscard]] bool createsDeadEnd(size_t cell) const noexcept {
+        return anyMove([&](auto k) {
+            const size_t neighbor = cell + OFFSETS[k];
+            return !board_.isVisitedCell(neighbor) && degree_[neighbor] == 1;
+        });
+    }
+
+    void orderCandidates(SearchFrame& frame, size_t cell) noexcept {
+        frame.square = static_cast<uint16_t>(cell);
+        frame.count = 0;
+        frame.cursor = 0;
+
+        // Same key as Solver::moveKey with CENTER_FAR: degree, then farther from center first
+        uint32_t keys[8];
+        forEachMove([&](auto k) {
+            const size_t target = cell + OFFSETS[k];
+            if (board_.isVisitedCell(target)) {
+                return;
+            }
+            const uint32_t key = (static_cast<uint32_t>(degree_[target]) << 16) |
+                                 (0xFFFFu - BoardType::CENTER_DISTANCES[target]);
+            uint8_t j = frame.count++;
+            for (; j > 0 && keys[j - 1] > key; --j) {
+                keys[j] = keys[j - 1];
+                frame.slots[j] = frame.slots[j - 1];
+            }
+            keys[j] = key;
+            frame.slots[j] = static_cast<uint8_t>(k);
+        });
+    }
+
+    bool search(size_t cell, int moveNumber) noexcept {
+        if (isSolution(moveNumber)) {
+            return true;
+        }
+
+        size_t depth = 0;
+        orderCandidates(frames_[0], cell);
+
+        while (true) {
+            SearchFrame& frame = frames_[depth];
+            bool descended = false;
+
+            while (frame.cursor < frame.count) {
+                const size_t move = frame.square + OFFSETS[frame.slots[frame.cursor++]];
+                if (frame.count > 1 && createsDeadEnd(move)) {
+                    continue;
+                }
+
+                makeMove(move, moveNumber);
+                ++moveNumber;
+                if (isSolution(moveNumber)) {
+                    return true;
+                }
+
+                orderCandidates(frames_[++depth], move);
+                descended = true;
+                break;
+            }
+
+            if (descended) {
+                continue;
+            }
+            if (depth == 0) {
+                return false;
+            }
+
+            unmakeMove(frames_[depth].square);
+            --depth;
+            --moveNumber;
+            ++backtrackCount_;
+        }
+    }
+};
+
+/**
+ * @brief Solve with a compile-time specialized solver if one exists for the size
+ *
+ * Square boards of 8, 10 and 12 are specialized. On a specialized size a
+ * tour is installed into solver with Solver::setSolution, and a failure is
+ * recorded with Solver::setUnsolved (the fixed solver's backtrack count and
+ * UNSOLVABLE), so the dynamic board and solver end up as after
+ * solver.solve() either way.
+ *
+ * @param solver Dynamic solver whose board has the given dimensions
+ * @param width Board width
+ * @param height Board height
+ * @param startRow Starting row position
+ * @param startCol Starting column position
+ * @param type Tour type
+ * @return std::nullopt if the size is not specialized, otherwise whether a tour was found
+ */
+std::optional<bool> solveSpecialized(Solver& solver, size_t width, size_t height,
+                                     int startRow, int startCol, TourType type);
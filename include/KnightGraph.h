@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Board.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Immutable knight-move adjacency table for a board size
+ *
+ * Stores the knight graph of a width x height board in CSR form: an offset
+ * array with one entry per square (plus a sentinel) and a flat array of
+ * neighbor indices, at most 8 per square. Neighbors of each square are
+ * listed in KNIGHT_MOVES order, which is also ascending index order.
+ *
+ * Used by the algorithms that need explicit neighbor lists: the
+ * divide-and-conquer solver (block tours and seam repair) and the tour
+ * counter. Board and Solver do not use it for move generation; the padded
+ * cell layout with fixed knight offsets is faster on every size (see
+ * knights_tour_bench layout).
+ *
+ * Tables are built once per (width, height) and shared by every Board of
+ * that size that asks for one. The process-wide cache holds weak
+ * references: a table is freed with its last user, so a server that sees
+ * many sizes keeps only the tables in use (a 1000x1000 table is ~36 MB).
+ */
+class KnightGraph {
+public:
+    /**
+     * @brief Get the shared graph for the given dimensions
+     * @param width Board width
+     * @param height Board height
+     * @return Shared graph, built if no live table of this size exists
+     */
+    [[nodiscard]] static std::shared_ptr<const KnightGraph> get(size_t width, size_t height);
+
+    KnightGraph(const KnightGraph&) = delete;
+    KnightGraph& operator=(const KnightGraph&) = delete;
+
+    [[nodiscard]] size_t width() const noexcept { return width_; }
+    [[nodiscard]] size_t height() const noexcept { return height_; }
+    [[nodiscard]] size_t size() const noexcept { return width_ * height_; }
+
+    /**
+     * @brief Convert 2D coordinates to a square index
+     */
+    [[nodiscard]] size_t toIndex(int row, int col) const noexcept {
+        return static_cast<size_t>(row) * width_ + static_cast<size_t>(col);
+    }
+
+    /**
+     * @brief Convert a square index back to 2D coordinates
+     */
+    [[nodiscard]] Move toMove(size_t index) const noexcept {
+        return {static_cast<int>(index / width_), static_cast<int>(index % width_)};
+    }
+
+    /**
+     * @brief Get the squares a knight can reach from a square
+     * @param index Square index
+     * @return Neighbor indices in KNIGHT_MOVES order
+     */
+    [[nodiscard]] std::span<const uint32_t> neighbors(size_t index) const noexcept {
+        return {neighbors_.data() + offsets_[index], neighbors_.data() + offsets_[index + 1]};
+    }
+
+    /**
+     * @brief Number of knight moves from a square on an empty board
+     */
+    [[nodiscard]] size_t degree(size_t index) const noexcept {
+        return offsets_[index + 1] - offsets_[index];
+    }
+
+private:
+    KnightGraph(size_t width, size_t height);
+
+    size_t width_;
+    size_t height_;
+    std::vector<uint32_t> offsets_;     // size() + 1 entries into neighbors_
+    std::vector<uint32_t> neighbors_;   // Flat neighbor index list
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Read-only view of a whole file, memory-mapped where supported
+ *
+ * On POSIX systems the file is mapped with mmap, so opening is O(1) and
+ * pages are read on demand. Elsewhere the file is read into memory.
+ * Move-only; the mapping is released on destruction.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    /**
+     * @brief Map a file
+     * @param path File to open
+     * @throws std::runtime_error if the file cannot be opened or mapped
+     */
+    explicit MappedFile(const std::string& path);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Get the file contents
+     * @return Pointer to the first byte (nullptr for an empty or closed file)
+     */
+    [[nodiscard]] const uint8_t* data() const noexcept { return data_; }
+
+    /**
+     * @brief Get the file size in bytes
+     */
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;           // data_ came from mmap (else it points into buffer_)
+    std::vector<uint8_t> buffer_;   // Contents when mmap is unavailable
+
+    void release() noexcept;
+};
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <string_view>
+
+/**
+ * @brief Chunked output buffer for the exporters
+ *
+ * Text is collected in a fixed buffer and handed to the stream in large
+ * write() calls; numbers are formatted with std::to_chars. This avoids the
+ * per-field cost of ostream formatting (sentry, locale, width state), which
+ * dominates when exporting boards with millions of squares.
+ *
+ * The << operators accept text, characters and integers, plus padded() and
+ * fixed()/general() wrappers that reproduce std::setw, std::fixed and the
+ * default floating-point format byte for byte.
+ */
+class OutputBuffer {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = size_t{1} << 16;
+
+    /**
+     * @brief Integer right-aligned in a field, like std::setw(width)
+     */
+    template<std::integral T>
+    struct Padded {
+        T value;
+        int width;
+    };
+
+    /**
+     * @brief Floating-point value in fixed or default (%g) notation
+     */
+    struct Floating {
+        double value;
+        std::chars_format format;
+        int precision;
+    };
+
+    /**
+     * @brief Create a buffer that writes to a stream
+     * @param out Destination stream
+     * @param capacity Buffer size in bytes
+     */
+    explicit OutputBuffer(std::ostream& out, size_t capacity = DEFAULT_CAPACITY)
+        : out_(out)
+        , buffer_(std::make_unique<char[]>(capacity))
+        , capacity_(capacity)
+        , size_(0)
+    {
+    }
+
+    ~OutputBuffer() { flush(); }
+
+    OutputBuffer(const OutputBuffer&) = delete;
+    OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+    /**
+     * @brief Write buffered bytes to the stream
+     * @return true if the stream is still good
+     */
+    bool flush() {
+        if (size_ > 0) {
+            out_.write(buffer_.get(), static_cast<std::streamsize>(size_));
+            size_ = 0;
+        }
+        return static_cast<bool>(out_);
+    }
+
+    OutputBuffer& operator<<(std::string_view text) {
+        if (text.size() > capacity_ - size_) {
+            flush();
+            if (text.size() > capacity_) {
+                out_.write(text.data(), static_cast<std::streamsize>(text.size()));
+                return *this;
+            }
+        }
+        std::memcpy(buffer_.get() + size_, text.data(), text.size());
+        size_ += text.size();
+        return *this;
+    }
+
+    OutputBuffer& operator<<(char c) {
+        if (size_ == capacity_) {
+            flush();
+        }
+        buffer_[size_++] = c;
+        return *this;
+    }
+
+    template<std::integral T>
+    OutputBuffer& operator<<(T value) {
+        char digits[24];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        return *this << std::string_view(digits, static_cast<size_t>(result.ptr - digits));
+    }
+
+    template<std::integral T>
+    OutputBuffer& operator<<(Padded<T> field) {
+        char digits[24];
+        auto result = std::to_chars(digits, digits + sizeof(digits), field.value);
+        const auto length = static_cast<int>(result.ptr - digits);
+        for (int i = length; i < field.width; ++i) {
+            *this << ' ';
+        }
+        return *this << std::string_view(digits, static_cast<size_t>(length));
+    }
+
+    OutputBuffer& operator<<(Floating field) {
+        char digits[64];
+        auto result = std::to_chars(digits, digits + sizeof(digits), field.value, field.format, field.precision);
+        return *this << std::string_view(digits, static_cast<size_t>(result.ptr - digits));
+    }
+
+    /**
+     * @brief Right-align an integer in a field of the given width
+     */
+    template<std::integral T>
+    [[nodiscard]] static Padded<T> padded(T value, int width) { return {value, width}; }
+
+    /**
+     * @brief Format like std::fixed << std::setprecision(precision)
+     */
+    [[nodiscard]] static Floating fixed(double value, int precision) {
+        return {value, std::chars_format::fixed, precision};
+    }
+
+    /**
+     * @brief Format like an ostream's default floating-point output (precision 6)
+     */
+    [[nodiscard]] static Floating general(double value, int precision = 6) {
+        return {value, std::chars_format::general, precision};
+    }
+
+private:
+    std::ostream& out_;
+    std::unique_ptr<char[]> buffer_;
+    size_t capacity_;
+    size_t size_;
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Board.h"
+#include "Solver.h"
+#include <stop_token>
+#include <vector>
+
+/**
+ * @brief Splits one backtracking search across threads with work stealing
+ *
+ * The top levels of the search tree are expanded into subtasks: every move
+ * sequence of splitDepth moves after the start that the serial search would
+ * explore, in the same best-first order. The subtasks are dealt round-robin
+ * into one deque per worker. Each worker has its own Board and Solver, takes
+ * tasks from the front of its own deque (best first) and steals from the
+ * back of the others when it runs dry. The first tour found sets a shared
+ * stop flag that cancels every in-flight search.
+ *
+ * Unlike PortfolioSolver, the workers explore disjoint parts of one tree, so
+ * exhaustive searches (e.g. proving that no closed tour exists from a start)
+ * are divided between the cores rather than repeated.
+ */
+class ParallelSolver {
+public:
+    /**
+     * @brief Construct a parallel solver for the given board
+     * @param board Reference to the board that receives the tour
+     * @param threadCount Number of worker threads (0 = hardware concurrency)
+     */
+    explicit ParallelSolver(Board& board, size_t threadCount = 0);
+
+    /**
+     * @brief Set how many levels of the tree are split into subtasks
+     * @param depth Levels below the start (0 = choose automatically)
+     */
+    void setSplitDepth(size_t depth) { splitDepth_ = depth; }
+
+    /**
+     * @brief Set a stop token that cancels the search when stop is requested
+     * @param token Stop token (a default-constructed token never stops)
+     */
+    void setStopToken(std::stop_token token) { stopToken_ = std::move(token); }
+
+    /**
+     * @brief Enable or disable the TourFeasibility pre-check
+     * @param enabled false to search even tours that cannot exist (default true)
+     */
+    void setFeasibilityCheck(bool enabled) { checkFeasibility_ = enabled; }
+
+    /**
+     * @brief Search for a tour on all worker threads
+     * @param startRow Starting row position (default 0)
+     * @param startCol Starting column position (default 0)
+     * @param type Tour type: OPEN or CLOSED (default OPEN)
+     * @return true if a tour was found
+     */
+    bool solve(int startRow = 0, int startCol = 0, TourType type = TourType::OPEN);
+
+    /**
+     * @brief Get the tour found by the last solve
+     * @return Vector of moves representing the solution
+     */
+    [[nodiscard]] const std::vector<Move>& getPath() const { return path_; }
+
+    /**
+     * @brief Get the backtracks performed by all workers together
+     * @return Total backtrack count of the last solve
+     */
+    [[nodiscard]] size_t getBacktrackCount() const { return backtrackCount_; }
+
+    /**
+     * @brief Get the number of subtasks the last solve was split into
+     * @return Subtask count
+     */
+    [[nodiscard]] size_t getTaskCount() const { return taskCount_; }
+
+    /**
+     * @brief Get the number of subtasks taken from another worker's deque
+     * @return Steal count of the last solve
+     */
+    [[nodiscard]] size_t getStealCount() const { return stealCount_; }
+
+    /**
+     * @brief Get the number of worker threads
+     * @return Thread count
+     */
+    [[nodiscard]] size_t getThreadCount() const { return threadCount_; }
+
+private:
+    Board& board_;
+    size_t threadCount_;
+    size_t splitDepth_;
+    std::stop_token stopToken_;
+    bool checkFeasibility_;
+    std::vector<Move> path_;
+    size_t backtrackCount_;
+    size_t taskCount_;
+    size_t stealCount_;
+
+    // Automatic split depth aims for at least this many tasks per worker
+    static constexpr size_t TASKS_PER_THREAD = 16;
+    static constexpr size_t MAX_AUTO_SPLIT_DEPTH = 12;
+
+    /**
+     * @brief Expand the top of the search tree into subtask prefixes
+     * @param startRow Starting row
+     * @param startCol Starting column
+     * @param type Tour type
+     * @return Prefixes in serial search order
+     */
+    [[nodiscard]] std::vector<std::vector<Move>> splitTasks(int startRow, int startCol, TourType type) const;
+};
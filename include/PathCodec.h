@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Board.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Compact encoding of a knight path: 3 bits per move
+ *
+ * Every step of a knight path is one of the 8 KNIGHT_MOVES, so a path is
+ * stored as its start square plus one 3-bit direction per step, packed
+ * least significant bit first. A 1000x1000 tour takes 375 KB instead of the
+ * 8 MB of its Move vector.
+ */
+class PathCodec {
+public:
+    static constexpr unsigned BITS_PER_MOVE = 3;
+
+    /**
+     * @brief Bytes needed for the directions of a path
+     * @param moveCount Number of squares in the path (steps = moveCount - 1)
+     */
+    [[nodiscard]] static constexpr size_t encodedSize(size_t moveCount) {
+        return moveCount < 2 ? 0 : ((moveCount - 1) * BITS_PER_MOVE + 7) / 8;
+    }
+
+    /**
+     * @brief Direction of a single knight step
+     * @return Index into Board::KNIGHT_MOVES, or -1 if the step is not a knight move
+     */
+    [[nodiscard]] static int direction(const Move& from, const Move& to);
+
+    /**
+     * @brief Read the direction of one step without decoding the others
+     * @param data Encoded directions (at least encodedSize(step + 2) bytes)
+     * @param step Step index (step i goes from square i to square i + 1)
+     * @return Index into Board::KNIGHT_MOVES
+     */
+    [[nodiscard]] static unsigned code(const uint8_t* data, size_t step) noexcept {
+        const size_t bit = step * BITS_PER_MOVE;
+        unsigned value = data[bit >> 3] >> (bit & 7);
+        if ((bit & 7) > 8 - BITS_PER_MOVE) {
+            value |= static_cast<unsigned>(data[(bit >> 3) + 1]) << (8 - (bit & 7));
+        }
+        return value & 7;
+    }
+
+    /**
+     * @brief Encode the steps of a path (the start square is not included)
+     * @param path Path to encode
+     * @param out Receives encodedSize(path.size()) bytes
+     * @return false if some step is not a knight move
+     */
+    static bool encode(const std::vector<Move>& path, std::vector<uint8_t>& out);
+
+    /**
+     * @brief Decode a path written by encode()
+     * @param data Encoded directions
+     * @param size Number of bytes available at data
+     * @param start First square of the path
+     * @param moveCount Number of squares in the path
+     * @param path Receives the decoded path
+     * @return false if size is smaller than encodedSize(moveCount)
+     */
+    static bool decode(const uint8_t* data, size_t size, const Move& start, size_t moveCount,
+                       std::vector<Move>& path);
+};
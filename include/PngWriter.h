@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Self-contained PNG encoder for 8-bit RGBA images
+ *
+ * Each scanline is stored with the Up filter, which turns the repeated rows
+ * of a rendered board into runs of zeros. The filtered image is compressed
+ * into one zlib stream made of a single fixed-Huffman deflate block, with a
+ * greedy LZ77 matcher (one hash probe per position, 32 KB window). This
+ * trades some file size for speed: no Huffman tables are built and long
+ * runs are skipped over in a few comparisons.
+ *
+ * The file has one IHDR, one IDAT and one IEND chunk.
+ */
+class PngWriter {
+public:
+    /**
+     * @brief Encode an image as PNG bytes
+     * @param rgba Pixels, row by row, 4 bytes (R, G, B, A) each
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @return Complete PNG file contents (empty if the size is zero or too large)
+     */
+    [[nodiscard]] static std::vector<uint8_t> encode(const uint8_t* rgba, size_t width, size_t height);
+
+    /**
+     * @brief Encode an image and write it to a file
+     * @param filename Output filename
+     * @param rgba Pixels, row by row, 4 bytes (R, G, B, A) each
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @return true if the file was written
+     */
+    static bool write(const std::string& filename, const uint8_t* rgba, size_t width, size_t height);
+
+    /**
+     * @brief Compress bytes into a zlib stream (RFC 1950/1951)
+     * @param data Bytes to compress
+     * @param size Number of bytes
+     * @param out Receives the stream (appended)
+     */
+    static void compress(const uint8_t* data, size_t size, std::vector<uint8_t>& out);
+
+    /**
+     * @brief CRC-32 as used by PNG chunks
+     * @param data Bytes to checksum
+     * @param size Number of bytes
+     * @param crc Running CRC to continue from
+     */
+    [[nodiscard]] static uint32_t crc32(const uint8_t* data, size_t size, uint32_t crc = 0) noexcept;
+
+    /**
+     * @brief Adler-32 as used by zlib streams
+     * @param data Bytes to checksum
+     * @param size Number of bytes
+     * @param adler Running checksum to continue from
+     */
+    [[nodiscard]] static uint32_t adler32(const uint8_t* data, size_t size, uint32_t adler = 1) noexcept;
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Board.h"
+#include "Solver.h"
+#include <cstdint>
+#include <stop_token>
+#include <vector>
+
+/**
+ * @brief One search configuration raced by PortfolioSolver
+ */
+struct PortfolioStrategy {
+    TieBreak tieBreak;   // Tie-break policy for equal-degree moves
+    uint64_t seed;       // Seed for TieBreak::RANDOM
+};
+
+/**
+ * @brief Races differently configured solvers across threads
+ *
+ * Warnsdorff backtracking has heavy-tailed runtimes: one tie-break order may
+ * backtrack for minutes where another finds a tour immediately. The
+ * portfolio runs one Solver per thread, each on its own Board copy with a
+ * different tie-break policy or random seed, and cancels the others as soon
+ * as one finds a tour. Runtime approaches that of the best strategy for the
+ * instance.
+ */
+class PortfolioSolver {
+public:
+    /**
+     * @brief Construct a portfolio solver for the given board
+     * @param board Reference to the board that receives the winning tour
+     * @param threadCount Number of strategies to race (0 = hardware concurrency)
+     */
+    explicit PortfolioSolver(Board& board, size_t threadCount = 0);
+
+    /**
+     * @brief Replace the raced strategies (one thread per strategy)
+     * @param strategies Strategies to race; must not be empty
+     */
+    void setStrategies(std::vector<PortfolioStrategy> strategies);
+
+    /**
+     * @brief Get the raced strategies
+     * @return Strategies, one per thread
+     */
+    [[nodiscard]] const std::vector<PortfolioStrategy>& getStrategies() const { return strategies_; }
+
+    /**
+     * @brief Default portfolio for a thread count
+     *
+     * The first strategy is the Solver default, so the portfolio is never
+     * slower than a plain solve by more than thread overhead. The next two
+     * use the other deterministic tie-breaks; the rest are seeded random.
+     *
+     * @param threadCount Number of strategies
+     * @return Strategies, one per thread
+     */
+    [[nodiscard]] static std::vector<PortfolioStrategy> defaultStrategies(size_t threadCount);
+
+    /**
+     * @brief Race all strategies and keep the first tour found
+     * @param startRow Starting row position (default 0)
+     * @param startCol Starting column position (default 0)
+     * @param type Tour type: OPEN or CLOSED (default OPEN)
+     * @return true if any strategy found a tour
+     */
+    bool solve(int startRow = 0, int startCol = 0, TourType type = TourType::OPEN);
+
+    /**
+     * @brief Set a stop token that cancels every strategy when stop is requested
+     * @param token Stop token (a default-constructed token never stops)
+     */
+    void setStopToken(std::stop_token token) { stopToken_ = std::move(token); }
+
+    /**
+     * @brief Get the solution path of the winning strategy
+     * @return Vector of moves representing the solution
+     */
+    [[nodiscard]] const std::vector<Move>& getPath() const { return path_; }
+
+    /**
+     * @brief Get the backtrack count of the winning strategy
+     * @return Backtracks performed by the winner, or by all strategies together
+     *         if none found a tour (e.g. after a stop)
+     */
+    [[nodiscard]] size_t getBacktrackCount() const { return backtrackCount_; }
+
+    /**
+     * @brief Get the index of the winning strategy
+     * @return Index into getStrategies(), or -1 if no tour was found
+     */
+    [[nodiscard]] int getWinner() const { return winner_; }
+
+private:
+    Board& board_;
+    std::vector<PortfolioStrategy> strategies_;
+    std::vector<Move> path_;
+    size_t backtrackCount_;
+    int winner_;
+    std::stop_token stopToken_;
+};
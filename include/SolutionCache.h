@@ -0,0 +1,152 @@
+#pragma once
+
+#include "Solver.h"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Identifies one solve: board size, start square and tour type
+ */
+struct SolutionKey {
+    size_t width;
+    size_t height;
+    int startRow;
+    int startCol;
+    TourType type;
+
+    bool operator==(const SolutionKey&) const = default;
+};
+
+/**
+ * @brief A tour stored in the cache
+ */
+struct CachedSolution {
+    std::vector<Move> path;     // The tour (first move is the start square)
+    size_t backtracks;          // Backtracks the original solve needed
+};
+
+/**
+ * @brief Cache of solved tours, in memory and optionally on disk
+ *
+ * Solver::solve is deterministic, so a tour found once for a (width,
+ * height, start, type) key can be replayed instead of searched again. The
+ * cache keeps the most recently used tours in memory (LRU) and, if given a
+ * directory, also writes every tour there as a .kt file (see TourFile) that
+ * is memory-mapped when read back, so later processes start with a warm
+ * cache.
+ *
+ * Cached tours are those of the default Warnsdorff search (Solver's default
+ * settings, or solveSpecialized), or of a search with restarts when solve()
+ * is given them; any tour answers the key. Searches that fail are not cached.
+ *
+ * All methods are thread-safe.
+ */
+class SolutionCache {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64;
+
+    /**
+     * @brief Create a cache
+     * @param capacity Number of tours kept in memory (at least 1)
+     * @param directory Directory for the on-disk store (empty = memory only);
+     *                  created on first write
+     */
+    explicit SolutionCache(size_t capacity = DEFAULT_CAPACITY, std::string directory = {});
+
+    /**
+     * @brief Look up a tour, in memory first and then on disk
+     *
+     * A disk hit whose header matches the key and whose checksum verifies is
+     * promoted into the memory layer. The moves are not checked for being a
+     * tour here; solve() installs them through Solver::setSolution, which does.
+     *
+     * @param key Solve to look up
+     * @return The tour, or nullptr on a miss
+     */
+    [[nodiscard]] std::shared_ptr<const CachedSolution> find(const SolutionKey& key);
+
+    /**
+     * @brief Add a tour to the memory layer and the disk store
+     * @param key Solve the tour answers
+     * @param solution Tour and backtrack count
+     */
+    void store(const SolutionKey& key, CachedSolution solution);
+
+    /**
+     * @brief Solve through the cache
+     *
+     * On a hit the cached tour is installed with Solver::setSolution. On a
+     * miss (or a cached tour that fails validation) the board is solved
+     * (with solveSpecialized where available, unless options set a limit or
+     * restarts, which only Solver supports) and a found tour is stored.
+     *
+     * @param solver Solver with default settings, on a width x height board
+     * @param width Board width
+     * @param height Board height
+     * @param startRow Starting row position
+     * @param startCol Starting column position
+     * @param type Tour type
+     * @param hit If not null, set to whether the tour came from the cache
+     * @param options Limits and restarts for the solve on a miss
+     * @return true if a tour was found or replayed
+     */
+    bool solve(Solver& solver, size_t width, size_t height, int startRow, int startCol, TourType type,
+               bool* hit = nullptr, const SolveOptions& options = SolveOptions{});
+
+    /**
+     * @brief Number of lookups answered from memory or disk
+     */
+    [[nodiscard]] size_t getHitCount() const;
+
+    /**
+     * @brief Number of lookups that missed both layers
+     */
+    [[nodiscard]] size_t getMissCount() const;
+
+    /**
+     * @brief Number of tours held in memory
+     */
+    [[nodiscard]] size_t size() const;
+
+    /**
+     * @brief Path of the disk file for a key (empty if memory only)
+     */
+    [[nodiscard]] std::string filePath(const SolutionKey& key) const;
+
+private:
+    struct KeyHash {
+        size_t operator()(const SolutionKey& key) const noexcept;
+    };
+
+    using Entry = std::pair<SolutionKey, std::shared_ptr<const CachedSolution>>;
+
+    size_t capacity_;
+    std::string directory_;
+    std::list<Entry> entries_;      // Most recently used first
+    std::unordered_map<SolutionKey, std::list<Entry>::iterator, KeyHash> index_;
+    size_t hits_;
+    size_t misses_;
+    mutable std::mutex mutex_;
+
+    /**
+     * @brief Insert into the memory layer, evicting the least recently used tour
+     */
+    void remember(const SolutionKey& key, std::shared_ptr<const CachedSolution> solution);
+
+    /**
+     * @brief Read and validate a disk entry
+     * @return The tour, or nullptr if there is no valid file for the key
+     */
+    [[nodiscard]] std::shared_ptr<const CachedSolution> load(const SolutionKey& key) const;
+
+    /**
+     * @brief Write a disk entry (via a temporary file, so readers never see a partial file)
+     */
+    void save(const SolutionKey& key, const CachedSolution& solution) const;
+};
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "BatchRunner.h"
+#include "SolverPool.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Fixed-size binary solve request (SolveServer protocol)
+ *
+ * Native little-endian integers, like the .kt header.
+ */
+struct SolveRequestHeader {
+    char magic[4];          // "KTRQ"
+    uint32_t width;
+    uint32_t height;
+    int32_t startRow;
+    int32_t startCol;
+    uint8_t tourType;       // 0 = open, 1 = closed
+    uint8_t algorithm;      // 0 = Warnsdorff, 1 = divide-and-conquer
+    uint8_t format;         // Response: 0 = .kt record, 1 = JSON
+    uint8_t reserved;
+};
+
+/**
+ * @brief Solve server on a Unix-domain socket
+ *
+ * Every message in either direction is a frame: a 4-byte little-endian
+ * payload length followed by the payload. A request payload is either a
+ * SolveRequestHeader (starting with "KTRQ") or a JSON object with the
+ * fields of a batch job line, e.g.
+ *
+ *     {"id": "a1", "size": 8, "start": [3, 4], "type": "closed", "format": "kt"}
+ *
+ * Binary requests are answered with a .kt record by default, JSON requests
+ * with the JSON result line of BatchRunner. A request that cannot be
+ * parsed or solved is answered with {"error": "..."}; a client tells the
+ * formats apart by the first byte ('K' or '{').
+ *
+ * A client may pipeline any number of requests without waiting. One epoll
+ * loop does all socket I/O and hands solves to a SolverPool; responses on
+ * a connection come back in request order. A connection stops being read
+ * while MAX_PIPELINE_DEPTH of its requests are unanswered or more than
+ * MAX_UNSENT_OUTPUT bytes of its responses are waiting to be sent, and
+ * resumes once the client reads them, so a client that never reads cannot
+ * queue unbounded work or output. Every connection stops being read while
+ * MAX_IN_FLIGHT solves are unanswered in total, so the loop never waits for
+ * room in the pool's queue.
+ *
+ * Each connection's solves share a stop token, which is triggered when the
+ * client disconnects or the server shuts down: queued solves then return
+ * at once and running Warnsdorff solves stop within a millisecond.
+ *
+ * Needs Linux (epoll); elsewhere the constructor throws.
+ */
+class SolveServer {
+public:
+    static constexpr char REQUEST_MAGIC[4] = {'K', 'T', 'R', 'Q'};
+    static constexpr size_t MAX_REQUEST_SIZE = 4096;
+    static constexpr size_t MAX_PIPELINE_DEPTH = 256;
+    static constexpr size_t MAX_IN_FLIGHT = SolverPool::DEFAULT_QUEUE_CAPACITY;
+    static constexpr size_t MAX_UNSENT_OUTPUT = size_t{1} << 20;
+
+    /**
+     * @brief Bind and listen on a socket path
+     * @param socketPath Filesystem path of the socket (a stale socket file is replaced)
+     * @param threadCount Solver threads (0 = hardware concurrency)
+     * @throws std::runtime_error if the socket cannot be created, or another server is listening there
+     */
+    explicit SolveServer(const std::string& socketPath, size_t threadCount = 0);
+
+    /**
+     * @brief Cancel unfinished solves, close every connection and remove the socket file
+     */
+    ~SolveServer();
+
+    SolveServer(const SolveServer&) = delete;
+    SolveServer& operator=(const SolveServer&) = delete;
+
+    /**
+     * @brief Serve until stop() is called
+     */
+    void run();
+
+    /**
+     * @brief Make run() return (thread-safe and async-signal-safe)
+     */
+    void stop() noexcept;
+
+    /**
+     * @brief Set the time limit of requests that do not give one
+     *
+     * Binary requests have no timeout field, so they always get this one.
+     *
+     * @param millis Milliseconds per Warnsdorff solve (0 = none)
+     */
+    void setDefaultTimeout(int64_t millis) { defaultTimeoutMillis_ = millis; }
+
+    /**
+     * @brief Parse one request payload
+     * @param payload Frame payload
+     * @param size Payload size in bytes
+     * @return The job; its format says how to answer
+     * @throws std::invalid_argument if the request is malformed or invalid
+     */
+    [[nodiscard]] static BatchJob parseRequest(const uint8_t* payload, size_t size);
+
+    /**
+     * @brief Append a frame (length prefix and payload) to a buffer
+     * @param payload Frame payload
+     * @param out Buffer to append to
+     */
+    static void appendFrame(std::string_view payload, std::string& out);
+
+    /**
+     * @brief Get the number of requests answered
+     */
+    [[nodiscard]] size_t getRequestCount() const { return requestCount_; }
+
+    /**
+     * @brief Get the number of connections accepted
+     */
+    [[nodiscard]] size_t getConnectionCount() const { return connectionCount_; }
+
+    /**
+     * @brief Get the number of solver threads
+     */
+    [[nodiscard]] size_t getThreadCount() const { return pool_->getThreadCount(); }
+
+private:
+    struct Connection {
+        int fd = -1;
+        std::string input;
+        size_t inputOffset = 0;                      // Start of the first unparsed frame
+        std::string output;
+        size_t outputOffset = 0;                     // Bytes of output already sent
+        uint64_t firstSequence = 0;                  // Sequence number of responses.front()
+        std::deque<std::optional<std::string>> responses;  // Unsent responses in request order
+        uint32_t events = 0;                         // Current epoll interest
+        bool readClosed = false;                     // Peer shut down its side, or a framing error
+        bool failed = false;                         // Socket error: close without sending the rest
+        std::stop_source cancel;                     // Stops this connection's solves when it closes
+    };
+
+    struct Completion {
+        uint64_t connection;
+        uint64_t sequence;
+        std::string frame;
+    };
+
+    std::string socketPath_;
+    int listenFd_;
+    int epollFd_;
+    int wakeFd_;                                     // eventfd: completions and stop()
+    std::atomic<bool> stopping_;
+    uint64_t nextConnectionId_;
+    std::unordered_map<uint64_t, Connection> connections_;
+    size_t requestCount_;
+    size_t connectionCount_;
+    int64_t defaultTimeoutMillis_;
+    size_t inFlight_;                                // Solves submitted and not yet delivered
+
+    std::mutex completionMutex_;
+    std::vector<Completion> completions_;            // Filled by solver threads
+
+    std::unique_ptr<SolverPool> pool_;               // Last: joined before the state above goes away
+
+    void acceptConnections();
+    void readFrom(uint64_t id, Connection& connection);
+    void parseRequests(uint64_t id, Connection& connection);
+    void deliverCompletions();
+    void writeTo(Connection& connection);
+    void update(uint64_t id, Connection& connection);
+    [[nodiscard]] bool acceptsRequests(const Connection& connection) const noexcept;
+    void closeConnection(uint64_t id, Connection& connection);
+    void wake() noexcept;
+    void closeFds() noexcept;
+
+    static std::string errorFrame(const std::string& message);
+};
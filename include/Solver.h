@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Board.h"
+#include <chrono>
+#include <cstdint>
+#include <stop_token>
 #include <vector>
 
 /**
@@ -11,6 +14,77 @@ enum class TourType {
     CLOSED   // Knight must end one move from start (forms a cycle)
 };
 
+/**
+ * @brief Backtracking implementation used by Solver::solve
+ */
+enum class SearchEngine {
+    ITERATIVE,   // Explicit preallocated frame stack (default, any board size)
+    RECURSIVE    // One call frame per move (limited by the thread's stack size)
+};
+
+/**
+ * @brief How moves with equal degree are ordered (Warnsdorff tie-break)
+ */
+enum class TieBreak {
+    CENTER_FAR,   // Prefer squares farther from the board center (default)
+    CENTER_NEAR,  // Prefer squares closer to the board center
+    MOVE_ORDER,   // Keep KNIGHT_MOVES order
+    RANDOM,       // CENTER_FAR, remaining ties in seeded random order
+    SHUFFLE       // Every degree tie in seeded random order (ignores the center)
+};
+
+/**
+ * @brief How a solve ended
+ */
+enum class SolveStatus {
+    SOLVED,            // Found a tour
+    UNSOLVABLE,        // Ruled out by TourFeasibility, or searched the whole tree without finding a tour
+    TIMED_OUT,         // Passed SolveOptions::deadline
+    BUDGET_EXHAUSTED,  // Used up SolveOptions::maxNodes or maxBacktracks
+    CANCELLED          // Stop requested through SolveOptions::stopToken
+};
+
+/**
+ * @brief Get the lowercase name of a solve status (e.g. "timed_out")
+ */
+[[nodiscard]] const char* solveStatusName(SolveStatus status);
+
+/**
+ * @brief Limits on one solve
+ *
+ * Every limit is off by default. The search polls them once every
+ * Solver::LIMIT_CHECK_INTERVAL moves, so a solve can run that many moves
+ * past a limit before it stops.
+ */
+struct SolveOptions {
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point deadline = Clock::time_point::max();
+    size_t maxNodes = 0;            // Most moves made (0 = unlimited)
+    size_t maxBacktracks = 0;       // Most backtracks (0 = unlimited)
+    std::stop_token stopToken;      // Cancels the solve when stop is requested
+    bool checkFeasibility = true;   // Reject tours TourFeasibility rules out without searching
+    size_t restartBacktracks = 0;   // Luby restart unit in backtracks, solve() only (0 = never restart)
+
+    /**
+     * @brief Options whose deadline is a duration from now
+     * @param timeout Time allowed for the solve
+     */
+    [[nodiscard]] static SolveOptions withTimeout(std::chrono::milliseconds timeout) {
+        SolveOptions options;
+        options.deadline = Clock::now() + timeout;
+        return options;
+    }
+
+    /**
+     * @brief Check whether any limit is set (checkFeasibility and restarts are not limits)
+     */
+    [[nodiscard]] bool isLimited() const {
+        return deadline != Clock::time_point::max() || maxNodes > 0 || maxBacktracks > 0 ||
+               stopToken.stop_possible();
+    }
+};
+
 /**
  * @brief Statistics about a solution path
  */
@@ -25,12 +99,38 @@ struct PathStatistics {
 /**
  * @brief Solves the Knight's Tour problem using backtracking
  *
- * This solver uses naive backtracking without heuristics.
- * It systematically explores all possible move sequences until
- * a solution is found or all possibilities are exhausted.
+ * The solver uses backtracking ordered by Warnsdorff's heuristic. It keeps
+ * the degree (number of unvisited neighbors) of every square in an array
+ * that is updated incrementally on each move and undo, so move ordering and
+ * dead-end checks read degrees in O(1).
+ *
+ * The search works on the board's padded cell indices: the 8 knight moves
+ * are fixed cell offsets and off-board targets land on always-visited
+ * border cells, so the hot path has no bounds checks or adjacency lookups.
+ *
+ * While searching, the only per-square state is a visited bitset and the
+ * degree bytes (about 1.1 bytes per cell, so a 100x100 search fits in L1).
+ * Move numbers are written to the board from the path once the search ends.
+ *
+ * A solve can be bounded by a deadline, a node or backtrack budget and a
+ * stop token (SolveOptions); getStatus() tells whether it found a tour,
+ * exhausted the tree or stopped on a limit. Tours that TourFeasibility
+ * proves impossible are reported UNSOLVABLE without searching.
+ *
+ * Backtracking runtimes are heavy-tailed: from a few start squares a fixed
+ * tie-break order backtracks for minutes. With
+ * SolveOptions::restartBacktracks set, solve() restarts the search from the
+ * start square whenever a run spends its backtrack allowance, which follows
+ * the Luby sequence (1, 1, 2, 1, 1, 2, 4, ...) times restartBacktracks. The
+ * first run uses the configured tie-break; later runs use TieBreak::SHUFFLE
+ * with a new seed each, so they explore different trees. Run lengths keep
+ * growing, so a tour is still found, or the tree proven empty, eventually.
  */
 class Solver {
 public:
+    // Moves between polls of the SolveOptions limits
+    static constexpr size_t LIMIT_CHECK_INTERVAL = 1024;
+
     /**
      * @brief Construct a solver for the given board
      * @param board Reference to the board to solve
@@ -46,6 +146,75 @@ public:
      */
     bool solve(int startRow = 0, int startCol = 0, TourType type = TourType::OPEN);
 
+    /**
+     * @brief Solve under limits
+     *
+     * Installs the options (see setOptions()) and solves. A solve that hits
+     * a limit leaves the board holding the partial path it had reached.
+     *
+     * @param startRow Starting row position
+     * @param startCol Starting column position
+     * @param type Tour type: OPEN or CLOSED
+     * @param options Deadline, budgets and stop token
+     * @return How the solve ended (UNSOLVABLE for a start off the board)
+     */
+    SolveStatus solve(int startRow, int startCol, TourType type, const SolveOptions& options);
+
+    /**
+     * @brief Solve with the first moves of the tour fixed
+     *
+     * Replays the prefix, then searches only its subtree. Used to split one
+     * search into independent subtasks (see ParallelSolver).
+     *
+     * @param prefix Fixed opening moves; the first is the starting position
+     * @param type Tour type: OPEN or CLOSED
+     * @return true if a tour extending the prefix was found, false otherwise
+     *         (including when the prefix is not a legal sequence of knight moves)
+     */
+    bool solveFrom(const std::vector<Move>& prefix, TourType type);
+
+    /**
+     * @brief List the moves the search would try after a prefix
+     *
+     * Moves are returned in search order with dead-end pruning applied, so
+     * searching each extended prefix with solveFrom() in turn explores the
+     * same tree as solveFrom(prefix). Leaves the board holding the prefix.
+     *
+     * @param prefix Fixed opening moves; the first is the starting position
+     * @param type Tour type: OPEN or CLOSED
+     * @return Next moves, best first (empty if the prefix is illegal or already a tour)
+     */
+    [[nodiscard]] std::vector<Move> candidateMoves(const std::vector<Move>& prefix, TourType type);
+
+    /**
+     * @brief Install a tour found elsewhere as this solver's solution
+     *
+     * Validates the path, numbers the board along it, and makes it available
+     * through getPath(), validatePath() and getPathStatistics() as if solve()
+     * had found it. Used for tours from other algorithms.
+     *
+     * @param path Tour to install (first move is the starting position)
+     * @param type Tour type the path must satisfy
+     * @param backtracks Backtrack count to report (default 0)
+     * @return true if the path is a valid tour of the given type
+     */
+    bool setSolution(const std::vector<Move>& path, TourType type, size_t backtracks = 0);
+
+    /**
+     * @brief Record a search done elsewhere that exhausted its tree without a tour
+     *
+     * Leaves the solver as a failed solve() from the same start would: the
+     * path holds only the starting square, the board numbers it, and the
+     * status is UNSOLVABLE. Used when a specialized solver fails. An invalid
+     * start only sets the status, as in solve().
+     *
+     * @param startRow Starting row position
+     * @param startCol Starting column position
+     * @param type Tour type that was searched for
+     * @param backtracks Backtrack count to report
+     */
+    void setUnsolved(int startRow, int startCol, TourType type, size_t backtracks);
+
     /**
      * @brief Get the solution path (sequence of moves)
      * @return Vector of moves representing the solution
@@ -58,6 +227,78 @@ public:
      */
     [[nodiscard]] size_t getBacktrackCount() const { return backtrackCount_; }
 
+    /**
+     * @brief Get number of restarts performed during solve
+     * @return Runs after the first (0 unless SolveOptions::restartBacktracks is set)
+     */
+    [[nodiscard]] size_t getRestartCount() const { return restartCount_; }
+
+    /**
+     * @brief Get the tour type of the last solve or installed solution
+     * @return OPEN or CLOSED
+     */
+    [[nodiscard]] TourType getTourType() const { return tourType_; }
+
+    /**
+     * @brief Select the backtracking engine used by solve()
+     * @param engine ITERATIVE (default) or RECURSIVE
+     */
+    void setSearchEngine(SearchEngine engine) { engine_ = engine; }
+
+    /**
+     * @brief Get the backtracking engine used by solve()
+     * @return Current search engine
+     */
+    [[nodiscard]] SearchEngine getSearchEngine() const { return engine_; }
+
+    /**
+     * @brief Select how moves with equal degree are ordered
+     * @param policy Tie-break policy (default CENTER_FAR)
+     * @param seed Random seed, used by TieBreak::RANDOM, SHUFFLE and restarts; each solve() restarts from it
+     */
+    void setTieBreak(TieBreak policy, uint64_t seed = 0);
+
+    /**
+     * @brief Get the tie-break policy
+     * @return Current tie-break policy
+     */
+    [[nodiscard]] TieBreak getTieBreak() const { return tieBreak_; }
+
+    /**
+     * @brief Set the limits of every following solve() and solveFrom()
+     * @param options Deadline, budgets and stop token (default: no limits)
+     */
+    void setOptions(SolveOptions options) { options_ = std::move(options); }
+
+    /**
+     * @brief Get the limits of following solves
+     */
+    [[nodiscard]] const SolveOptions& getOptions() const { return options_; }
+
+    /**
+     * @brief Set a stop token that cancels solve() when stop is requested
+     *
+     * Shorthand for setting SolveOptions::stopToken. A cancelled solve
+     * returns false and leaves the board partially filled.
+     *
+     * @param token Stop token (a default-constructed token never stops)
+     */
+    void setStopToken(std::stop_token token) { options_.stopToken = std::move(token); }
+
+    /**
+     * @brief Get how the last solve() or solveFrom() ended
+     * @return Status (SOLVED after setSolution() installs a tour)
+     */
+    [[nodiscard]] SolveStatus getStatus() const { return status_; }
+
+    /**
+     * @brief Check whether the last solve() stopped early on a limit or cancellation
+     * @return true if the search stopped before exhausting its tree
+     */
+    [[nodiscard]] bool wasStopped() const {
+        return status_ != SolveStatus::SOLVED && status_ != SolveStatus::UNSOLVABLE;
+    }
+
     /**
      * @brief Reset solver state
      */
@@ -76,21 +317,156 @@ public:
     [[nodiscard]] PathStatistics getPathStatistics() const;
 
 private:
+    /**
+     * @brief One level of the iterative search
+     *
+     * Candidates are stored as knight move numbers (indices into
+     * Board::knightOffsets()), ordered best first, so a frame is 16 bytes.
+     */
+    struct SearchFrame {
+        uint32_t square;      // Cell the knight stands on at this depth
+        uint8_t count;        // Number of ordered candidates
+        uint8_t cursor;       // Next candidate to try
+        uint8_t slots[8];     // Candidate knight moves, best first
+    };
+
     Board& board_;
     std::vector<Move> path_;
+    std::vector<uint8_t> degree_;       // Degree map (see DegreeKernels), kept current by makeMove/unmakeMove
+    std::vector<uint64_t> visited_;     // Visited bit of every board cell during the search (border cells always set)
+    std::vector<uint64_t> emptyVisited_;    // visited_ for an empty board: only the border bits
+    std::vector<uint16_t> centerDistance_;  // Manhattan distance of every board cell from the center
+    std::vector<SearchFrame> frames_;   // Preallocated stack for the iterative engine (one frame per square)
     size_t backtrackCount_;
     int startRow_;
     int startCol_;
     TourType tourType_;
+    SearchEngine engine_;
+    TieBreak tieBreak_;
+    uint64_t seed_;             // Seed for TieBreak::RANDOM, SHUFFLE and restarts
+    uint64_t rngState_;         // Random state, reset from seed_ on each solve
+    SolveOptions options_;
+    size_t nodeCount_;          // Moves made during the current solve
+    size_t nextLimitCheck_;     // nodeCount_ at which the limits are next polled
+    SolveStatus status_;
+    size_t restartCount_;       // Restarts during the current solve
+    size_t runBacktrackLimit_;  // backtrackCount_ at which the current run restarts (0 = never)
+    bool restartPending_;       // The current run spent its allowance and is unwinding
+
+    /**
+     * @brief Term i of the Luby sequence (1, 1, 2, 1, 1, 2, 4, 1, ...)
+     * @param i Term index, from 1
+     */
+    [[nodiscard]] static uint64_t lubyTerm(uint64_t i);
+
+    /**
+     * @brief Count a move and poll the limits every LIMIT_CHECK_INTERVAL moves
+     *
+     * The hot path is one increment and compare; checkLimits() runs out of line.
+     *
+     * @return true if the search must stop
+     */
+    [[nodiscard]] bool shouldStop() {
+        return ++nodeCount_ >= nextLimitCheck_ && checkLimits();
+    }
+
+    /**
+     * @brief Poll the deadline, budgets and stop token, recording why the search stops
+     * @return true if the search must stop
+     */
+    bool checkLimits();
+
+    /**
+     * @brief Record the status of a finished search
+     * @param solved Whether the search found a tour
+     * @return solved
+     */
+    bool finishSearch(bool solved);
+
+    /**
+     * @brief Reset search state and place the knight on the start square
+     * @param startRow Starting row (must be valid)
+     * @param startCol Starting column (must be valid)
+     * @param type Tour type
+     */
+    void beginSearch(int startRow, int startCol, TourType type);
+
+    /**
+     * @brief Put the search back to just the knight on the start square
+     *
+     * Keeps the counters, so a restarted solve reports its total work.
+     */
+    void resetToStart();
+
+    /**
+     * @brief Search with Luby restarts (see SolveOptions::restartBacktracks)
+     * @param cell Start cell (the knight must be on it alone)
+     * @return true if solution found
+     */
+    bool searchWithRestarts(size_t cell);
+
+    /**
+     * @brief Reset search state and make the moves of a prefix
+     * @param prefix Opening moves; the first is the starting position
+     * @param type Tour type
+     * @return false if the prefix is not a legal sequence of knight moves
+     */
+    bool replayPrefix(const std::vector<Move>& prefix, TourType type);
+
+    /**
+     * @brief Check the visited bit of a cell (border cells are always visited)
+     * @param cell Cell index
+     * @return true if the knight has been on the cell, or it is off the board
+     */
+    [[nodiscard]] bool isVisited(size_t cell) const { return (visited_[cell >> 6] >> (cell & 63)) & 1; }
+
+    /**
+     * @brief Number the board along path_ (and clear every other square)
+     *
+     * The search only keeps visited bits, so this runs once when it ends.
+     */
+    void materializeBoard();
+
+    /**
+     * @brief Run the selected search engine from the current position
+     * @param cell Cell the knight currently stands on
+     * @param moveNumber Move number of the next square to visit
+     * @return true if solution found
+     */
+    bool search(size_t cell, int moveNumber);
+
+    /**
+     * @brief Next value of the tie-break random generator (xorshift64*)
+     */
+    [[nodiscard]] uint64_t nextRandom();
+
+    /**
+     * @brief Iterative backtracking over the explicit frame stack
+     *
+     * Explores moves in exactly the same order as backtrack(), but keeps its
+     * state in frames_ instead of the call stack, so board size is not
+     * limited by the thread's stack.
+     *
+     * @param cell Cell the knight currently stands on
+     * @param moveNumber Move number of the next square to visit
+     * @return true if solution found
+     */
+    bool searchIterative(size_t cell, int moveNumber);
+
+    /**
+     * @brief Fill a frame with the ordered candidate moves from a square
+     * @param frame Frame to initialize
+     * @param cell Cell the knight stands on
+     */
+    void orderCandidates(SearchFrame& frame, size_t cell);
 
     /**
      * @brief Recursive backtracking function
-     * @param row Current row position
-     * @param col Current column position
+     * @param cell Current cell
      * @param moveNumber Current move number (1-indexed)
      * @return true if solution found from this position
      */
-    bool backtrack(int row, int col, int moveNumber);
+    bool backtrack(size_t cell, int moveNumber);
 
     /**
      * @brief Check if current state is a valid solution
@@ -99,28 +475,46 @@ private:
      */
     [[nodiscard]] bool isSolution(int moveNumber) const;
 
+    /**
+     * @brief Visit a square and update the degrees of its neighbors
+     *
+     * Every neighbor loses one available move, so the degree array stays
+     * equal to the number of unvisited neighbors of each square. The move
+     * number is the square's position in path_.
+     *
+     * @param cell Cell to visit
+     */
+    void makeMove(size_t cell);
+
+    /**
+     * @brief Undo makeMove for the most recently visited square
+     * @param cell Cell to un-visit
+     */
+    void unmakeMove(size_t cell);
+
     /**
      * @brief Calculate the degree of a move (number of available moves from that position)
      *
      * The degree represents how many valid unvisited squares the knight can reach
      * from the given position. This is a key metric for move ordering heuristics.
+     * Reads the incrementally maintained degree array, so it is O(1).
      *
-     * @param move The move to calculate degree for
+     * @param cell Cell to calculate degree for
      * @return Number of valid unvisited moves from that position
      */
-    [[nodiscard]] int calculateDegree(const Move& move) const;
+    [[nodiscard]] int calculateDegree(size_t cell) const { return degree_[cell]; }
 
     /**
-     * @brief Count available moves from a given position
+     * @brief Compute the ordering key of a move (lower is tried first)
      *
-     * Helper function to determine how many unvisited squares are accessible
-     * from the specified position. Used for move ordering and heuristics.
+     * Degree ascending (Warnsdorff's rule), then the tie-break policy; by
+     * default Manhattan distance from the board center descending so
+     * edge/corner squares are visited earlier.
      *
-     * @param row Row position to check from
-     * @param col Column position to check from
-     * @return Number of valid unvisited moves available
+     * @param cell Cell of the move
+     * @return Sort key
      */
-    [[nodiscard]] int countAvailableMoves(int row, int col) const;
+    [[nodiscard]] uint32_t moveKey(size_t cell);
 
     /**
      * @brief Sort moves using a move ordering heuristic
@@ -129,20 +523,20 @@ private:
      * ordering by degree (Warnsdorff's heuristic foundation).
      * Lower degree moves are preferred as they visit "harder to reach" squares first.
      *
-     * @param moves Vector of moves to sort (modified in-place)
+     * @param moves Cells to sort (modified in-place)
      */
-    void sortMoves(std::vector<Move>& moves) const;
+    void sortMoves(StaticSquareList& moves);
 
     /**
      * @brief Check if a move would create isolated squares (dead ends)
      *
-     * Performs look-ahead pruning by temporarily making a move and checking
-     * if any of its neighbors would become isolated (degree 0). This helps
-     * avoid exploring paths that will inevitably fail.
+     * Look-ahead pruning: checks if any unvisited neighbor of the move would
+     * become isolated (degree 0) once the move is made. This helps avoid
+     * exploring paths that will inevitably fail. Tests all 8 neighbors at
+     * once with DegreeKernels::anyNeighborAtOne.
      *
-     * @param move The move to check
-     * @param moveNumber The move number that would be assigned
+     * @param cell Cell of the move to check
      * @return true if the move creates dead ends, false otherwise
      */
-    [[nodiscard]] bool createsDeadEnd(const Move& move, int moveNumber) const;
+    [[nodiscard]] bool createsDeadEnd(size_t cell) const;
 };
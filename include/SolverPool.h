@@ -0,0 +1,112 @@
+#pragma once
+
+#include "BoundedQueue.h"
+#include "SolverWorkspace.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Runs independent solves on a fixed set of worker threads
+ *
+ * Each worker owns a SolverWorkspace, so it reuses the same Board and
+ * Solver for every job of a size instead of constructing them per solve.
+ * Jobs go through a bounded MPMC queue: submit() blocks once
+ * queueCapacity jobs are waiting, which keeps a producer that enumerates
+ * millions of start squares from buffering them all.
+ *
+ * Results come back through a std::future or a callback. Callbacks run on
+ * the worker thread that solved the job, so they must be thread-safe.
+ *
+ * The destructor finishes the queued jobs and joins the workers.
+ */
+class SolverPool {
+public:
+    static constexpr size_t DEFAULT_QUEUE_CAPACITY = 1024;
+
+    using Callback = std::function<void(SolveResult&&)>;
+
+    /**
+     * @brief Start the workers
+     * @param threadCount Number of worker threads (0 = hardware concurrency)
+     * @param queueCapacity Most jobs waiting at once
+     */
+    explicit SolverPool(size_t threadCount = 0, size_t queueCapacity = DEFAULT_QUEUE_CAPACITY);
+
+    ~SolverPool();
+
+    SolverPool(const SolverPool&) = delete;
+    SolverPool& operator=(const SolverPool&) = delete;
+
+    /**
+     * @brief Queue a job, waiting for room
+     * @param job Job to solve (start square and algorithm must suit the board)
+     * @return Future for the job's result
+     * @throws std::invalid_argument if the job is invalid (see SolverWorkspace::validate)
+     */
+    [[nodiscard]] std::future<SolveResult> submit(const SolveJob& job);
+
+    /**
+     * @brief Queue a job whose result is handed to a callback
+     * @param job Job to solve
+     * @param callback Called on a worker thread with the result (must not throw)
+     * @throws std::invalid_argument if the job is invalid (see SolverWorkspace::validate)
+     */
+    void submit(const SolveJob& job, Callback callback);
+
+    /**
+     * @brief Wait until every job submitted so far has finished
+     */
+    void wait();
+
+    /**
+     * @brief Get the number of worker threads
+     */
+    [[nodiscard]] size_t getThreadCount() const { return workers_.size(); }
+
+    /**
+     * @brief Get the number of finished jobs
+     */
+    [[nodiscard]] size_t getCompletedCount() const { return completed_.load(); }
+
+    /**
+     * @brief Get number of Board/Solver pairs the workers have allocated
+     */
+    [[nodiscard]] size_t getBoardAllocations() const { return boardAllocations_.load(); }
+
+    /**
+     * @brief Throughput of the latest busy period
+     *
+     * Measured from the submit that found the pool idle to the last
+     * completion, so a sweep submitted and waited for in one go reports
+     * its own solves per second.
+     */
+    [[nodiscard]] double getSolvesPerSecond() const;
+
+private:
+    struct Task {
+        SolveJob job;
+        Callback callback;
+    };
+
+    BoundedQueue<Task> queue_;
+
+    mutable std::mutex progressMutex_;
+    std::condition_variable progress_;
+    size_t submitted_;
+    std::atomic<size_t> completed_;
+    size_t periodStartCompleted_;       // completed_ when the pool last went from idle to busy
+    std::chrono::steady_clock::time_point periodStart_;
+    std::chrono::steady_clock::time_point lastCompletion_;
+    std::atomic<size_t> boardAllocations_;
+
+    std::vector<std::jthread> workers_;  // Last: joined before anything above is destroyed
+
+    void workerLoop();
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Board.h"
+#include "Solver.h"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <stop_token>
+#include <vector>
+
+/**
+ * @brief One solve request: board size, start square, tour type and algorithm
+ */
+struct SolveJob {
+    size_t width = 8;
+    size_t height = 8;
+    int startRow = 0;
+    int startCol = 0;
+    TourType type = TourType::OPEN;
+    bool divide = false;        // Divide-and-conquer instead of Warnsdorff
+    int64_t timeoutMillis = 0;  // Warnsdorff time limit (0 = none)
+    size_t maxBacktracks = 0;   // Warnsdorff backtrack budget (0 = none)
+    size_t restartBacktracks = 0;  // Warnsdorff Luby restart unit (0 = never restart)
+    std::stop_token stopToken;  // Cancels a Warnsdorff solve (default: never)
+};
+
+/**
+ * @brief Outcome of a SolveJob
+ */
+struct SolveResult {
+    SolveJob job;
+    bool solved = false;
+    SolveStatus status = SolveStatus::UNSOLVABLE;
+    std::vector<Move> path;     // The tour (empty if none was found)
+    size_t backtracks = 0;
+    int64_t micros = 0;         // Solve time
+};
+
+/**
+ * @brief Boards and solvers reused across solves
+ *
+ * Keeps one Board and Solver for each of the maxBoards most recently used
+ * board sizes. A Solver resets all of its state at the start of every
+ * solve, so a run of jobs allocates a board only when it sees a new size.
+ * Warnsdorff jobs on the sizes FixedSolver specializes go to the
+ * compile-time solver, as in the CLI, unless the job sets a time limit,
+ * backtrack budget, stop token or restarts (FixedSolver has none of them).
+ *
+ * Not thread-safe: use one workspace per thread (see SolverPool).
+ */
+class SolverWorkspace {
+public:
+    static constexpr size_t DEFAULT_MAX_BOARDS = 16;
+
+    /**
+     * @brief Create an empty workspace
+     * @param maxBoards Number of board sizes whose Board and Solver are kept (at least 1)
+     */
+    explicit SolverWorkspace(size_t maxBoards = DEFAULT_MAX_BOARDS);
+
+    /**
+     * @brief Check that a job can be solved
+     * @param job Job to check
+     * @throws std::invalid_argument if the board size is outside 1-1000, the
+     *         start square is off the board, or divide-and-conquer is asked
+     *         for on a board it does not support
+     */
+    static void validate(const SolveJob& job);
+
+    /**
+     * @brief Solve a job on the board of its size
+     *
+     * The result stays in lastSolver() until the next solve.
+     *
+     * @param job Job to solve (must pass validate())
+     * @return true if a tour was found
+     */
+    bool solve(const SolveJob& job);
+
+    /**
+     * @brief Solve a job and copy out the result
+     * @param job Job to solve
+     * @return The job's result, with timing
+     */
+    [[nodiscard]] SolveResult run(const SolveJob& job);
+
+    /**
+     * @brief Solver used by the last solve()
+     */
+    [[nodiscard]] const Solver& lastSolver() const { return workspaces_.front()->solver; }
+
+    /**
+     * @brief How the last solve() ended
+     */
+    [[nodiscard]] SolveStatus lastStatus() const { return lastStatus_; }
+
+    /**
+     * @brief Get number of Board/Solver pairs allocated (one per size seen, plus re-creations after eviction)
+     */
+    [[nodiscard]] size_t getBoardAllocations() const { return boardAllocations_; }
+
+private:
+    struct Workspace {
+        Board board;
+        Solver solver;
+
+        Workspace(size_t width, size_t height) : board(width, height), solver(board) {}
+    };
+
+    size_t maxBoards_;
+    std::list<std::unique_ptr<Workspace>> workspaces_;  // Most recently used first
+    size_t boardAllocations_;
+    SolveStatus lastStatus_;
+
+    Workspace& workspaceFor(size_t width, size_t height);
+};
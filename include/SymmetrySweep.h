@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Board.h"
+#include "Solver.h"
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Symmetries of a rectangular board (the dihedral group)
+ *
+ * Every symmetry maps knight moves to knight moves, so it maps a tour to a
+ * tour of the same type. Square boards have all eight; other rectangles
+ * only the four that keep width and height in place.
+ */
+enum class Symmetry {
+    IDENTITY,
+    ROTATE_90,        // Clockwise (square boards only)
+    ROTATE_180,
+    ROTATE_270,       // Clockwise (square boards only)
+    FLIP_HORIZONTAL,  // Mirror left-right
+    FLIP_VERTICAL,    // Mirror top-bottom
+    TRANSPOSE,        // Mirror in the main diagonal (square boards only)
+    ANTI_TRANSPOSE    // Mirror in the anti-diagonal (square boards only)
+};
+
+/**
+ * @brief Start squares that are images of each other under board symmetries
+ */
+struct StartOrbit {
+    Move representative;             // Square that is actually solved
+    std::vector<Move> squares;       // Every square of the orbit (representative first)
+    std::vector<Symmetry> transforms;  // transforms[i] maps representative to squares[i]
+};
+
+/**
+ * @brief Result of one start square in a sweep
+ */
+struct SweepResult {
+    Move start;                // Starting square
+    bool solved;               // Whether a tour from this square was found
+    bool derived;              // Tour transformed from the orbit representative
+    size_t backtracks;         // Backtracks of the solve that produced the tour
+    std::vector<Move> path;    // Tour from start (empty if not solved)
+};
+
+using SweepCallback = std::function<void(const SweepResult&)>;
+
+/**
+ * @brief Solves every start square of a board, one solve per symmetry orbit
+ *
+ * Start squares related by a board symmetry have the same outcome: a tour
+ * from one, mapped through the symmetry, is a tour from the other. The sweep
+ * solves only the representative of each orbit and derives the tours of the
+ * other squares by transforming the path, which cuts the work about 8x on
+ * square boards (10 solves instead of 64 on 8x8) and 4x on rectangles.
+ *
+ * Derived tours are valid tours from their square, but not necessarily the
+ * tour a direct solve would return: Warnsdorff tie-breaking is not symmetric.
+ */
+class SymmetrySweep {
+public:
+    /**
+     * @brief Construct a sweep over every start square of a board
+     * @param width Board width
+     * @param height Board height
+     */
+    SymmetrySweep(size_t width, size_t height);
+
+    /**
+     * @brief Get the symmetries of a board
+     * @param width Board width
+     * @param height Board height
+     * @return 8 symmetries for square boards, 4 otherwise (identity first)
+     */
+    [[nodiscard]] static std::vector<Symmetry> symmetries(size_t width, size_t height);
+
+    /**
+     * @brief Map a square through a symmetry
+     * @param symmetry Symmetry to apply (must be valid for the board)
+     * @param square Square to map
+     * @param width Board width
+     * @param height Board height
+     * @return Image of the square
+     */
+    [[nodiscard]] static Move transform(Symmetry symmetry, Move square, size_t width, size_t height);
+
+    /**
+     * @brief Map every square of a path through a symmetry
+     * @param symmetry Symmetry to apply (must be valid for the board)
+     * @param path Path to map
+     * @param width Board width
+     * @param height Board height
+     * @return Image of the path
+     */
+    [[nodiscard]] static std::vector<Move> transformPath(Symmetry symmetry, const std::vector<Move>& path,
+                                                         size_t width, size_t height);
+
+    /**
+     * @brief Get the start-square orbits, in row-major order of their representatives
+     * @return Orbits covering every square exactly once
+     */
+    [[nodiscard]] const std::vector<StartOrbit>& orbits() const { return orbits_; }
+
+    /**
+     * @brief Solve one representative per orbit and report every square
+     *
+     * Each orbit's squares are reported together, representative first.
+     *
+     * @param solver Solver for a board of this sweep's dimensions (its settings are used)
+     * @param type Tour type: OPEN or CLOSED
+     * @param callback Called once per square
+     * @return Number of squares with a tour
+     */
+    size_t run(Solver& solver, TourType type, const SweepCallback& callback) const;
+
+private:
+    size_t width_;
+    size_t height_;
+    std::vector<StartOrbit> orbits_;
+};
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Board.h"
+#include "Solver.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Receives each tour found by TourCounter::enumerate
+ *
+ * The path holds every square in visiting order, starting with the start
+ * square. Return false to stop the enumeration.
+ */
+using TourCallback = std::function<bool(const std::vector<Move>&)>;
+
+/**
+ * @brief Counts and enumerates all knight's tours on small boards
+ *
+ * Two modes:
+ * - enumerate() walks every tour from one start square (exhaustive
+ *   backtracking with only sound pruning) and streams each to a callback.
+ * - count() counts all tours of the board without listing them, using a
+ *   frontier dynamic program: squares are added column by column along the
+ *   long side, and partial solutions are merged whenever they agree on the
+ *   state of the frontier (the degree of each square that still has
+ *   unprocessed moves, and which squares are the two ends of the same path
+ *   fragment). The number of distinct frontier states depends only on the
+ *   short side, so 3xN and 4xN boards are counted in time linear in N.
+ *
+ * count() treats a tour and its reverse as the same tour, and a closed tour
+ * as the same cycle whatever square it starts on. enumerate() lists directed
+ * tours from one square, so summing enumerate() over all starts gives twice
+ * count() for open tours, and enumerate() from any start gives twice count()
+ * for closed tours.
+ *
+ * Boards that TourFeasibility proves have no tour of the requested type
+ * (e.g. closed tours on 7x7) are answered 0 at once, whatever their size.
+ */
+class TourCounter {
+public:
+    // Longest short side count() accepts. Frontier states grow exponentially
+    // in it: 6x6 takes about 2 s for closed tours and 2 minutes for open ones,
+    // and a short side of 7 would not finish in hours.
+    static constexpr size_t MAX_FRONTIER_SIDE = 6;
+
+    /**
+     * @brief Construct a counter for the given board
+     * @param board Board whose dimensions are used; enumerate() uses it as scratch space
+     */
+    explicit TourCounter(Board& board);
+
+    /**
+     * @brief Enumerate every tour from a start square
+     * @param startRow Starting row position
+     * @param startCol Starting column position
+     * @param type Tour type: OPEN or CLOSED
+     * @param callback Called with each tour (optional)
+     * @return Number of tours found (reported to the callback)
+     */
+    uint64_t enumerate(int startRow, int startCol, TourType type, const TourCallback& callback = {});
+
+    /**
+     * @brief Count all tours of the board with the frontier dynamic program
+     * @param type Tour type: OPEN or CLOSED
+     * @return Number of distinct tours (reversals and rotations of a cycle counted once)
+     * @throws std::invalid_argument if the short side exceeds MAX_FRONTIER_SIDE and the
+     *         board is not proven to have no tour
+     * @throws std::overflow_error if the count does not fit in 64 bits
+     */
+    uint64_t count(TourType type);
+
+    /**
+     * @brief Get the largest number of frontier states held during the last count()
+     * @return Peak state count
+     */
+    [[nodiscard]] size_t getPeakStateCount() const { return peakStates_; }
+
+private:
+    Board& board_;
+    std::vector<uint8_t> degree_;   // Unvisited-neighbor count of every square during enumerate()
+    size_t peakStates_;
+};
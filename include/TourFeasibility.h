@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Solver.h"
+#include <cstddef>
+
+/**
+ * @brief O(1) existence conditions for knight's tours on rectangles
+ *
+ * Solver::solve consults these before searching, so a request for a tour
+ * that cannot exist returns UNSOLVABLE at once instead of exhausting the
+ * search tree (which can take hours, e.g. for a closed tour on 7x7).
+ *
+ * With m <= n the sides of the board:
+ * - Closed tours (Schwenk, 1991) exist unless m and n are both odd,
+ *   m is 1, 2 or 4, or m is 3 and n is 4, 6 or 8.
+ * - Open tours (Conrad et al., 1994) exist on 1x1, on 3x4 and 3xn for
+ *   n >= 7, on 4xn for n >= 5, and on every board with m >= 5.
+ * - On an odd-area board a knight alternates square colors, so an open
+ *   tour visits one more square of the corners' color than of the other
+ *   and must start on a corner-colored square ((row + col) even).
+ * - On a 4xn board the two outer lines only connect to the two inner
+ *   ones, which hold as many squares. A path starting on an inner line
+ *   would have to alternate inner and outer squares, putting every inner
+ *   square on the same color, so open tours start on an outer line.
+ *
+ * The checks only reject tours that are proven not to exist: every start of
+ * a board with a closed tour has one, but not every start allowed here is
+ * known to begin an open tour.
+ */
+class TourFeasibility {
+public:
+    /**
+     * @brief Check whether a board has a closed tour (Schwenk's theorem)
+     * @param width Board width
+     * @param height Board height
+     */
+    [[nodiscard]] static bool hasClosedTour(size_t width, size_t height) noexcept;
+
+    /**
+     * @brief Check whether a board has an open tour from some start square
+     * @param width Board width
+     * @param height Board height
+     */
+    [[nodiscard]] static bool hasOpenTour(size_t width, size_t height) noexcept;
+
+    /**
+     * @brief Explain why no tour of a type can start on a square
+     * @param width Board width
+     * @param height Board height
+     * @param startRow Starting row (must be on the board)
+     * @param startCol Starting column (must be on the board)
+     * @param type Tour type
+     * @return Why the tour is impossible, or nullptr if it is not ruled out
+     */
+    [[nodiscard]] static const char* whyImpossible(size_t width, size_t height, int startRow, int startCol,
+                                                   TourType type) noexcept;
+
+    /**
+     * @brief Check that a tour is not ruled out (whyImpossible() returns nullptr)
+     */
+    [[nodiscard]] static bool isPossible(size_t width, size_t height, int startRow, int startCol,
+                                         TourType type) noexcept {
+        return whyImpossible(width, height, startRow, startCol, type) == nullptr;
+    }
+};
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "Board.h"
+#include "MappedFile.h"
+#include "Solver.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Header of a binary tour file (.kt)
+ *
+ * A .kt file is this header, then a block index, then the moves:
+ *  - header: fixed 56 bytes, native little-endian integers
+ *  - block index: blockCount squares (int32 row, int32 col), the square at
+ *    position b * blockSize of the path for every block b
+ *  - moves: the steps of the path as 3-bit KNIGHT_MOVES indices (PathCodec)
+ *
+ * A million-square tour takes about 375 KB of moves plus 8 bytes of index
+ * per block. The checksum (64-bit FNV-1a) covers the index and the moves.
+ */
+struct TourFileHeader {
+    char magic[4];          // "KTR1"
+    uint32_t width;
+    uint32_t height;
+    int32_t startRow;
+    int32_t startCol;
+    uint32_t tourType;      // 0 = open, 1 = closed
+    uint64_t moveCount;     // Squares in the path, start included
+    uint64_t backtracks;    // Backtracks of the search that found the tour
+    uint32_t blockSize;     // Moves per index block
+    uint32_t blockCount;
+    uint64_t checksum;
+};
+
+/**
+ * @brief Writes binary tour files
+ */
+class TourFile {
+public:
+    static constexpr char MAGIC[4] = {'K', 'T', 'R', '1'};
+    static constexpr uint32_t DEFAULT_BLOCK_SIZE = 1024;
+
+    /**
+     * @brief Write a path as a .kt file
+     * @param filename Output filename
+     * @param path Path to write (consecutive squares must be knight moves)
+     * @param width Board width
+     * @param height Board height
+     * @param type Tour type recorded in the header
+     * @param backtracks Backtrack count recorded in the header
+     * @param blockSize Moves per index block (random access decodes at most this many)
+     * @return true if the file was written
+     */
+    static bool write(const std::string& filename, const std::vector<Move>& path, size_t width, size_t height,
+                      TourType type, uint64_t backtracks = 0, uint32_t blockSize = DEFAULT_BLOCK_SIZE);
+
+    /**
+     * @brief Encode a path as the bytes of a .kt file
+     * @param path Path to encode (consecutive squares must be knight moves)
+     * @param width Board width
+     * @param height Board height
+     * @param type Tour type recorded in the header
+     * @param backtracks Backtrack count recorded in the header
+     * @param blockSize Moves per index block
+     * @param out Receives the file contents (appended)
+     * @return true if the path could be encoded
+     */
+    static bool encode(const std::vector<Move>& path, size_t width, size_t height, TourType type,
+                       uint64_t backtracks, uint32_t blockSize, std::vector<uint8_t>& out);
+
+    /**
+     * @brief 64-bit FNV-1a hash, as used for the file checksum
+     * @param data Bytes to hash
+     * @param size Number of bytes
+     * @param seed Running hash to continue from
+     */
+    [[nodiscard]] static uint64_t checksum(const uint8_t* data, size_t size,
+                                           uint64_t seed = 1469598103934665603ULL) noexcept;
+};
+
+/**
+ * @brief Memory-mapped reader for .kt files
+ *
+ * Opening maps the file and checks the header and section sizes, which is
+ * O(1) in the tour length. move(i) decodes from the nearest index entry, so
+ * random access costs at most one block of 3-bit steps. The checksum is only
+ * computed by verify().
+ */
+class TourReader {
+public:
+    /**
+     * @brief Open a tour file
+     * @param filename File to open
+     * @throws std::runtime_error if the file cannot be read or is not a valid .kt file
+     */
+    explicit TourReader(const std::string& filename);
+
+    [[nodiscard]] size_t width() const noexcept { return header_.width; }
+    [[nodiscard]] size_t height() const noexcept { return header_.height; }
+    [[nodiscard]] TourType tourType() const noexcept {
+        return header_.tourType == 0 ? TourType::OPEN : TourType::CLOSED;
+    }
+    [[nodiscard]] uint64_t backtracks() const noexcept { return header_.backtracks; }
+
+    /**
+     * @brief Number of squares in the path
+     */
+    [[nodiscard]] size_t size() const noexcept { return static_cast<size_t>(header_.moveCount); }
+
+    /**
+     * @brief First square of the path
+     */
+    [[nodiscard]] Move start() const noexcept { return {header_.startRow, header_.startCol}; }
+
+    /**
+     * @brief Get square i of the path
+     * @param i Position in the path (0 = start)
+     * @throws std::out_of_range if i >= size()
+     */
+    [[nodiscard]] Move move(size_t i) const;
+
+    /**
+     * @brief Decode the whole path
+     */
+    [[nodiscard]] std::vector<Move> readAll() const;
+
+    /**
+     * @brief Check the stored checksum against the file contents
+     * @return true if the index and moves are intact
+     */
+    [[nodiscard]] bool verify() const;
+
+private:
+    MappedFile file_;
+    TourFileHeader header_;
+    const uint8_t* index_;      // blockCount (row, col) pairs
+    const uint8_t* moves_;      // PathCodec-encoded steps
+    size_t movesSize_;
+};
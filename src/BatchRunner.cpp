@@ -0,0 +1,270 @@
+#include "BatchRunner.h"
+#include "OutputBuffer.h"
+#include "SolverPool.h"
+#include "TourFile.h"
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+// Largest board side Board accepts
+constexpr int MAX_SIDE = 1000;
+
+// Results a threaded run keeps in flight per solver thread before waiting for the oldest
+constexpr size_t JOBS_IN_FLIGHT_PER_THREAD = 64;
+
+int parseInt(const std::string& key, std::string_view text) {
+    int value = 0;
+    auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (result.ec != std::errc() || result.ptr != text.data() + text.size()) {
+        throw std::invalid_argument("bad number for " + key + ": '" + std::string(text) + "'");
+    }
+    return value;
+}
+
+size_t parseSide(const std::string& key, std::string_view text) {
+    const int value = parseInt(key, text);
+    if (value < 1 || value > MAX_SIDE) {
+        throw std::invalid_argument(key + " must be between 1 and " + std::to_string(MAX_SIDE));
+    }
+    return static_cast<size_t>(value);
+}
+
+}  // namespace
+
+BatchRunner::BatchRunner(BatchFormat defaultFormat, size_t threadCount)
+    : defaultFormat_(defaultFormat)
+    , jobCount_(0)
+    , solvedCount_(0)
+    , defaultTimeoutMillis_(0)
+    , interactive_(true)
+{
+    if (threadCount != 1) {
+        pool_ = std::make_unique<SolverPool>(threadCount);
+    }
+}
+
+BatchRunner::~BatchRunner() = default;
+
+size_t BatchRunner::getBoardAllocations() const {
+    return workspace_.getBoardAllocations() + (pool_ ? pool_->getBoardAllocations() : 0);
+}
+
+size_t BatchRunner::getThreadCount() const {
+    return pool_ ? pool_->getThreadCount() : 1;
+}
+
+BatchJob BatchRunner::parseJob(const std::string& line, BatchFormat defaultFormat) {
+    BatchJob job;
+    job.format = defaultFormat;
+
+    std::istringstream fields(line);
+    std::string field;
+    while (fields >> field) {
+        const size_t equals = field.find('=');
+        if (equals == std::string::npos) {
+            throw std::invalid_argument("expected key=value, got '" + field + "'");
+        }
+        const std::string key = field.substr(0, equals);
+        const std::string_view value = std::string_view(field).substr(equals + 1);
+
+        if (key == "size") {
+            job.width = job.height = parseSide(key, value);
+        } else if (key == "width") {
+            job.width = parseSide(key, value);
+        } else if (key == "height") {
+            job.height = parseSide(key, value);
+        } else if (key == "start") {
+            const size_t comma = value.find(',');
+            if (comma == std::string_view::npos) {
+                throw std::invalid_argument("start must be R,C");
+            }
+            job.startRow = parseInt(key, value.substr(0, comma));
+            job.startCol = parseInt(key, value.substr(comma + 1));
+        } else if (key == "type") {
+            if (value != "open" && value != "closed") {
+                throw std::invalid_argument("type must be open or closed");
+            }
+            job.type = value == "closed" ? TourType::CLOSED : TourType::OPEN;
+        } else if (key == "format") {
+            if (value != "json" && value != "kt") {
+                throw std::invalid_argument("format must be json or kt");
+            }
+            job.format = value == "kt" ? BatchFormat::BINARY : BatchFormat::JSON;
+        } else if (key == "algo") {
+            if (value != "warnsdorff" && value != "divide") {
+                throw std::invalid_argument("algo must be warnsdorff or divide");
+            }
+            job.divide = value == "divide";
+        } else if (key == "timeout") {
+            job.timeoutMillis = parseInt(key, value);
+        } else if (key == "budget") {
+            const int budget = parseInt(key, value);
+            if (budget < 0) {
+                throw std::invalid_argument("budget must not be negative");
+            }
+            job.maxBacktracks = static_cast<size_t>(budget);
+        } else if (key == "restart") {
+            const int unit = parseInt(key, value);
+            if (unit < 0) {
+                throw std::invalid_argument("restart must not be negative");
+            }
+            job.restartBacktracks = static_cast<size_t>(unit);
+        } else if (key == "id") {
+            job.id = value;
+        } else {
+            throw std::invalid_argument("unknown key '" + key + "'");
+        }
+    }
+
+    SolverWorkspace::validate(job);
+    for (char c : job.id) {
+        if (c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20) {
+            throw std::invalid_argument("id must not contain quotes, backslashes or control characters");
+        }
+    }
+    return job;
+}
+
+bool BatchRunner::process(const BatchJob& job, OutputBuffer& out) {
+    auto start = std::chrono::steady_clock::now();
+    const bool solved = workspace_.solve(job);
+    auto micros = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+
+    const Solver& solver = workspace_.lastSolver();
+    write(job, workspace_.lastStatus(), solver.getPath(), solver.getBacktrackCount(), static_cast<int64_t>(micros),
+          out);
+    return solved;
+}
+
+size_t BatchRunner::run(std::istream& in, std::ostream& out, std::ostream& errors) {
+    struct Pending {
+        BatchJob job;
+        std::future<SolveResult> result;
+    };
+
+    OutputBuffer buffer(out);
+    std::deque<Pending> pending;
+    const size_t maxPending = getThreadCount() * JOBS_IN_FLIGHT_PER_THREAD;
+    auto writeOldest = [&] {
+        SolveResult result = pending.front().result.get();
+        write(pending.front().job, result.status, result.path, result.backtracks, result.micros, buffer);
+        pending.pop_front();
+    };
+
+    std::string line;
+    size_t lineNumber = 0;
+    size_t rejected = 0;
+    while (std::getline(in, line)) {
+        ++lineNumber;
+        const size_t first = line.find_first_not_of(" \t\r");
+        if (first != std::string::npos && line[first] != '#') {
+            try {
+                BatchJob job = parseJob(line, defaultFormat_);
+                if (job.timeoutMillis == 0) {
+                    job.timeoutMillis = defaultTimeoutMillis_;
+                }
+                if (pool_) {
+                    auto result = pool_->submit(job);
+                    pending.push_back({std::move(job), std::move(result)});
+                } else {
+                    process(job, buffer);
+                }
+            } catch (const std::invalid_argument& e) {
+                buffer.flush();
+                errors << "line " << lineNumber << ": " << e.what() << "\n";
+                ++rejected;
+            }
+        }
+
+        // Write finished results in order; wait for the oldest only when too many are in flight
+        while (!pending.empty() &&
+               (pending.size() > maxPending ||
+                pending.front().result.wait_for(std::chrono::seconds(0)) == std::future_status::ready)) {
+            writeOldest();
+        }
+
+        // Hand results over before we might block waiting for more jobs. A
+        // file never waits on us, so there only the finished ones go out.
+        if (in.rdbuf()->in_avail() <= 0) {
+            while (interactive_ && !pending.empty()) {
+                writeOldest();
+            }
+            buffer.flush();
+            out.flush();
+        }
+    }
+
+    while (!pending.empty()) {
+        writeOldest();
+    }
+    buffer.flush();
+    out.flush();
+    return rejected;
+}
+
+void BatchRunner::write(const BatchJob& job, SolveStatus status, const std::vector<Move>& path, size_t backtracks,
+                        int64_t micros, OutputBuffer& out) {
+    ++jobCount_;
+    if (status == SolveStatus::SOLVED) {
+        ++solvedCount_;
+    }
+    writeResult(job, status, path, backtracks, micros, out);
+}
+
+void BatchRunner::writeResult(const BatchJob& job, SolveStatus status, const std::vector<Move>& path, size_t backtracks,
+                              int64_t micros, OutputBuffer& out) {
+    if (job.format == BatchFormat::BINARY) {
+        writeBinary(job, status, path, backtracks, out);
+    } else {
+        writeJSON(job, status, path, backtracks, micros, out);
+    }
+}
+
+void BatchRunner::writeJSON(const BatchJob& job, SolveStatus status, const std::vector<Move>& path, size_t backtracks,
+                            int64_t micros, OutputBuffer& out) {
+    const bool solved = status == SolveStatus::SOLVED;
+    out << "{\"id\":\"" << job.id << "\",\"width\":" << job.width << ",\"height\":" << job.height
+        << ",\"start\":[" << job.startRow << ',' << job.startCol << "],\"type\":\""
+        << (job.type == TourType::CLOSED ? "closed" : "open") << "\",\"solved\":" << (solved ? "true" : "false")
+        << ",\"status\":\"" << solveStatusName(status) << "\",\"backtracks\":" << backtracks
+        << ",\"micros\":" << micros << ",\"path\":[";
+    if (solved) {
+        for (size_t i = 0; i < path.size(); ++i) {
+            if (i > 0) {
+                out << ',';
+            }
+            out << '[' << path[i].row << ',' << path[i].col << ']';
+        }
+    }
+    out << "]}\n";
+}
+
+void BatchRunner::writeBinary(const BatchJob& job, SolveStatus status, const std::vector<Move>& path, size_t backtracks,
+                              OutputBuffer& out) {
+    std::vector<uint8_t> record;
+    if (status != SolveStatus::SOLVED || !TourFile::encode(path, job.width, job.height, job.type, backtracks,
+                                     TourFile::DEFAULT_BLOCK_SIZE, record)) {
+        // Header only: no moves, no index
+        TourFileHeader header{};
+        std::memcpy(header.magic, TourFile::MAGIC, sizeof(TourFile::MAGIC));
+        header.width = static_cast<uint32_t>(job.width);
+        header.height = static_cast<uint32_t>(job.height);
+        header.startRow = job.startRow;
+        header.startCol = job.startCol;
+        header.tourType = job.type == TourType::CLOSED ? 1 : 0;
+        header.backtracks = backtracks;
+        header.blockSize = TourFile::DEFAULT_BLOCK_SIZE;
+        header.checksum = TourFile::checksum(nullptr, 0);
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&header);
+        record.assign(bytes, bytes + sizeof(header));
+    }
+    out << std::string_view(reinterpret_cast<const char*>(record.data()), record.size());
+}
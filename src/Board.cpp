@@ -1,4 +1,5 @@
 #include "Board.h"
+#include "KnightGraph.h"
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
@@ -6,7 +7,8 @@
 Board::Board(size_t width, size_t height)
     : width_(width)
     , height_(height)
-    , board_(width * height, 0)
+    , stride_(width + 2 * BORDER)
+    , knightOffsets_{}
 {
     if (width == 0 || height == 0) {
         throw std::invalid_argument("Board dimensions must be positive");
@@ -14,6 +16,21 @@ Board::Board(size_t width, size_t height)
     if (width > 1000 || height > 1000) {
         throw std::invalid_argument("Board dimensions too large (max 1000x1000)");
     }
+
+    // Every cell starts as border; clear() then opens the board squares
+    cells_.assign(stride_ * (height + 2 * BORDER), SENTINEL);
+    clear();
+
+    for (size_t i = 0; i < 8; ++i) {
+        knightOffsets_[i] = KNIGHT_MOVES[i].row * static_cast<ptrdiff_t>(stride_) + KNIGHT_MOVES[i].col;
+    }
+}
+
+const KnightGraph& Board::graph() const {
+    if (!graph_) {
+        graph_ = KnightGraph::get(width_, height_);
+    }
+    return *graph_;
 }
 
 bool Board::isValid(int row, int col) const noexcept {
@@ -29,18 +46,22 @@ int Board::at(int row, int col) const {
     if (!isValid(row, col)) {
         throw std::out_of_range("Board coordinates out of range");
     }
-    return board_[toIndex(row, col)];
+    return cells_[cellIndex(row, col)];
 }
 
 void Board::set(int row, int col, int moveNumber) {
     if (!isValid(row, col)) {
         throw std::out_of_range("Board coordinates out of range");
     }
-    board_[toIndex(row, col)] = moveNumber;
+    setByCell(cellIndex(row, col), moveNumber);
 }
 
 void Board::clear() noexcept {
-    std::fill(board_.begin(), board_.end(), 0);
+    // Reset the board squares row by row; the border stays SENTINEL
+    for (size_t row = 0; row < height_; ++row) {
+        auto first = cells_.begin() + static_cast<ptrdiff_t>(cellIndex(static_cast<int>(row), 0));
+        std::fill(first, first + static_cast<ptrdiff_t>(width_), 0);
+    }
 }
 
 bool Board::isVisited(int row, int col) const {
@@ -58,7 +79,7 @@ void Board::print() const {
     for (size_t row = 0; row < height_; ++row) {
         std::cout << "|";
         for (size_t col = 0; col < width_; ++col) {
-            int value = board_[toIndex(row, col)];
+            int value = cells_[cellIndex(static_cast<int>(row), static_cast<int>(col))];
             if (value == 0) {
                 std::cout << std::setw(cellWidth) << "." << "|";
             } else {
@@ -89,7 +110,7 @@ void Board::printDetailed(const Move* highlightStart, const Move* highlightEnd)
     for (size_t row = 0; row < height_; ++row) {
         std::cout << std::setw(2) << row << " |";
         for (size_t col = 0; col < width_; ++col) {
-            int value = board_[toIndex(row, col)];
+            int value = cells_[cellIndex(static_cast<int>(row), static_cast<int>(col))];
 
             // Check if this position should be highlighted
             bool isStart = highlightStart && highlightStart->row == static_cast<int>(row) && highlightStart->col == static_cast<int>(col);
@@ -134,7 +155,7 @@ void Board::printCompact(size_t maxSize) const {
 
     for (size_t row = 0; row < sampleSize; ++row) {
         for (size_t col = 0; col < sampleSize; ++col) {
-            int value = board_[toIndex(row, col)];
+            int value = cells_[cellIndex(static_cast<int>(row), static_cast<int>(col))];
             std::cout << std::setw(4) << (value == 0 ? "." : std::to_string(value));
         }
         std::cout << "\n";
@@ -148,7 +169,7 @@ void Board::printCompact(size_t maxSize) const {
 
         for (size_t row = startRow; row < height_; ++row) {
             for (size_t col = startCol; col < width_; ++col) {
-                int value = board_[toIndex(row, col)];
+                int value = cells_[cellIndex(static_cast<int>(row), static_cast<int>(col))];
                 std::cout << std::setw(4) << (value == 0 ? "." : std::to_string(value));
             }
             std::cout << "\n";
@@ -158,34 +179,35 @@ void Board::printCompact(size_t maxSize) const {
 }
 
 std::vector<Move> Board::getValidMoves(int row, int col, bool onlyUnvisited) const {
-    std::vector<Move> validMoves;
-    validMoves.reserve(8);  // Maximum possible knight moves
+    StaticMoveList moves;
+    getValidMoves(row, col, moves, onlyUnvisited);
+    return std::vector<Move>(moves.begin(), moves.end());
+}
 
-    for (const auto& move : KNIGHT_MOVES) {
-        int newRow = row + move.row;
-        int newCol = col + move.col;
+void Board::getValidMoves(int row, int col, StaticMoveList& moves, bool onlyUnvisited) const {
+    moves.clear();
+    if (!isValid(row, col)) {
+        return;
+    }
 
-        if (isValid(newRow, newCol)) {
-            if (!onlyUnvisited || !isVisited(newRow, newCol)) {
-                validMoves.push_back({newRow, newCol});
-            }
+    // Fixed offsets: border cells read as visited
+    const size_t cell = cellIndex(row, col);
+    for (ptrdiff_t offset : knightOffsets_) {
+        const int value = cells_[cell + offset];
+        if (value == 0 || (!onlyUnvisited && value != SENTINEL)) {
+            moves.push_back(cellToMove(cell + offset));
         }
     }
-
-    return validMoves;
 }
 
 int Board::countValidMoves(int row, int col) const {
+    if (!isValid(row, col)) {
+        return 0;
+    }
+    const size_t cell = cellIndex(row, col);
     int count = 0;
-
-    for (const auto& move : KNIGHT_MOVES) {
-        int newRow = row + move.row;
-        int newCol = col + move.col;
-
-        if (isValid(newRow, newCol) && !isVisited(newRow, newCol)) {
-            ++count;
-        }
+    for (ptrdiff_t offset : knightOffsets_) {
+        count += cells_[cell + offset] == 0;
     }
-
     return count;
 }
@@ -0,0 +1,165 @@
+#include "DegreeKernels.h"
+#include "Board.h"
+#include <algorithm>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define KNIGHTS_TOUR_AVX2_KERNEL 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+/**
+ * @brief Padded-layout geometry shared by the kernels
+ */
+struct Geometry {
+    size_t width;
+    size_t height;
+    size_t stride;
+    std::array<ptrdiff_t, 8> offsets;
+
+    Geometry(size_t w, size_t h) : width(w), height(h), stride(w + 2 * Board::BORDER), offsets{} {
+        for (size_t k = 0; k < 8; ++k) {
+            offsets[k] = Board::KNIGHT_MOVES[k].row * static_cast<ptrdiff_t>(stride) + Board::KNIGHT_MOVES[k].col;
+        }
+    }
+
+    [[nodiscard]] size_t cellIndex(size_t row, size_t col) const {
+        return (row + Board::BORDER) * stride + col + Board::BORDER;
+    }
+    [[nodiscard]] size_t cellCount() const { return stride * (height + 2 * Board::BORDER); }
+};
+
+inline bool testBit(const std::vector<uint64_t>& bits, size_t pos) {
+    return (bits[pos >> 6] >> (pos & 63)) & 1;
+}
+
+// Degree byte of one board cell
+inline uint8_t cellDegree(const std::vector<uint64_t>& visited, const Geometry& g, size_t cell) {
+    uint8_t free = 0;
+    for (ptrdiff_t offset : g.offsets) {
+        free += !testBit(visited, cell + offset);
+    }
+    return testBit(visited, cell) ? static_cast<uint8_t>(free + DegreeKernels::VISITED_FLAG) : free;
+}
+
+// Up to 57 bits of the bitset starting at an arbitrary bit position
+inline uint64_t extractBits(const uint64_t* words, size_t pos) {
+    const size_t word = pos >> 6;
+    const unsigned shift = pos & 63;
+    uint64_t bits = words[word] >> shift;
+    if (shift > 0) {
+        bits |= words[word + 1] << (64 - shift);
+    }
+    return bits;
+}
+
+// SPREAD[b] has byte i equal to bit i of b
+constexpr std::array<uint64_t, 256> SPREAD = [] {
+    std::array<uint64_t, 256> table{};
+    for (size_t b = 0; b < 256; ++b) {
+        for (size_t i = 0; i < 8; ++i) {
+            table[b] |= static_cast<uint64_t>((b >> i) & 1) << (8 * i);
+        }
+    }
+    return table;
+}();
+
+// Portable kernel: 8 cells per step, one byte lane per cell in a 64-bit word
+// (lanes never carry: a lane holds at most 8 + VISITED_FLAG)
+size_t computeScalar(const std::vector<uint64_t>& visited, const Geometry& g, uint8_t* degree, size_t first, size_t last) {
+    const uint64_t* words = visited.data();
+    constexpr uint64_t EIGHTS = 0x0808080808080808ULL;
+
+    size_t cell = first;
+    for (; cell + 8 <= last; cell += 8) {
+        uint64_t visitedNeighbors = 0;
+        for (ptrdiff_t offset : g.offsets) {
+            visitedNeighbors += SPREAD[extractBits(words, cell + offset) & 0xFF];
+        }
+        const uint64_t own = SPREAD[extractBits(words, cell) & 0xFF];
+        const uint64_t lanes = EIGHTS - visitedNeighbors + own * DegreeKernels::VISITED_FLAG;
+        std::memcpy(degree + cell, &lanes, sizeof(lanes));
+    }
+    for (; cell < last; ++cell) {
+        degree[cell] = cellDegree(visited, g, cell);
+    }
+    return cell;
+}
+
+#ifdef KNIGHTS_TOUR_AVX2_KERNEL
+
+// One byte per bit: 0xFF where the bit is set, 0 elsewhere
+__attribute__((target("avx2")))
+inline __m256i expandBits(uint32_t bits) {
+    const __m256i select = _mm256_setr_epi64x(0x0000000000000000LL, 0x0101010101010101LL,
+                                              0x0202020202020202LL, 0x0303030303030303LL);
+    const __m256i mask = _mm256_set1_epi64x(static_cast<long long>(0x8040201008040201ULL));
+    __m256i bytes = _mm256_shuffle_epi8(_mm256_set1_epi32(static_cast<int>(bits)), select);
+    return _mm256_cmpeq_epi8(_mm256_and_si256(bytes, mask), mask);
+}
+
+// AVX2 kernel: 32 cells per step. Returns the first cell it did not compute
+// (the portable kernel finishes the tail)
+__attribute__((target("avx2")))
+size_t computeAvx2(const std::vector<uint64_t>& visited, const Geometry& g, uint8_t* degree, size_t first, size_t last) {
+    const uint64_t* words = visited.data();
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i flag = _mm256_set1_epi8(static_cast<char>(DegreeKernels::VISITED_FLAG));
+
+    size_t cell = first;
+    for (; cell + 32 <= last; cell += 32) {
+        __m256i count = zero;
+        for (ptrdiff_t offset : g.offsets) {
+            // cmpeq gives -1 for each unvisited neighbor; subtracting adds 1
+            __m256i neighbor = expandBits(static_cast<uint32_t>(extractBits(words, cell + offset)));
+            count = _mm256_sub_epi8(count, _mm256_cmpeq_epi8(neighbor, zero));
+        }
+        __m256i own = expandBits(static_cast<uint32_t>(extractBits(words, cell)));
+        count = _mm256_add_epi8(count, _mm256_and_si256(own, flag));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(degree + cell), count);
+    }
+    return cell;
+}
+
+#endif
+
+}  // namespace
+
+DegreeKernels::Isa DegreeKernels::activeIsa() {
+#ifdef KNIGHTS_TOUR_AVX2_KERNEL
+    static const Isa detected = __builtin_cpu_supports("avx2") ? Isa::AVX2 : Isa::SCALAR;
+    return detected;
+#else
+    return Isa::SCALAR;
+#endif
+}
+
+void DegreeKernels::computeDegreeMap(const std::vector<uint64_t>& visited, size_t width, size_t height,
+                                     std::vector<uint8_t>& degree, Isa isa) {
+    const Geometry g(width, height);
+    degree.resize(g.cellCount());
+
+    // Every board cell lies in [first, last); the border columns in between
+    // are computed too and overwritten below
+    const size_t first = g.cellIndex(0, 0);
+    const size_t last = g.cellIndex(height - 1, width - 1) + 1;
+    size_t cell = first;
+
+#ifdef KNIGHTS_TOUR_AVX2_KERNEL
+    if (isa == Isa::AVX2 && activeIsa() == Isa::AVX2) {
+        cell = computeAvx2(visited, g, degree.data(), first, last);
+    }
+#else
+    (void)isa;
+#endif
+    computeScalar(visited, g, degree.data(), cell, last);
+
+    // Border: the two rows above and below, and two columns on each side
+    std::fill(degree.begin(), degree.begin() + static_cast<ptrdiff_t>(first), BORDER_DEGREE);
+    std::fill(degree.begin() + static_cast<ptrdiff_t>(last), degree.end(), BORDER_DEGREE);
+    for (size_t row = 0; row + 1 < height; ++row) {
+        const size_t end = g.cellIndex(row, width - 1) + 1;
+        std::fill_n(degree.begin() + static_cast<ptrdiff_t>(end), 2 * Board::BORDER, BORDER_DEGREE);
+    }
+}
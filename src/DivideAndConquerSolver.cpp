@@ -0,0 +1,193 @@
+#include "DivideAndConquerSolver.h"
+#include "KnightGraph.h"
+
+namespace {
+
+/**
+ * @brief Precomputed structured closed tour of one block
+ *
+ * The tour starts at (0,0); each character is the index into
+ * Board::KNIGHT_MOVES of the next move. The final move back to (0,0) is
+ * implied.
+ */
+struct BlockTour {
+    size_t width;
+    size_t height;
+    const char* moves;
+};
+
+constexpr BlockTour BLOCK_TOURS[] = {
+    {5, 6, "73762017235672415401374453014"},
+    {5, 8, "737672417210171465473123672275101247314"},
+    {5, 10, "7376762010171467136746037263501012476377421053014"},
+    {6, 5, "76306531266015367217420377104"},
+    {6, 6, "57542015364601356720376241037176421"},
+    {6, 7, "54153640356237642103717672405413560542050"},
+    {6, 8, "77653024551217672405410135676062101723717236621"},
+    {6, 9, "53745014267671453127720276351206510324653237674201036"},
+    {6, 10, "53745014267675320565024715120562013540476337203767624172101"},
+    {7, 6, "57724173501263762401371764201723536720641"},
+    {7, 8, "5653126376723624054172101537456423730004745311424545502"},
+    {7, 10, "767501136660536201367141767624010136067675314542410517445350101260471"},
+    {8, 5, "556203536062364535123672174240153564241"},
+    {8, 6, "53732426750601377506301465104672415023751762421"},
+    {8, 7, "7671275350632413144176312426503671376424172103537456200"},
+    {8, 8, "767506010372657530104671564101366406631017376723624210153564104"},
+    {8, 9, "76763531020475771010424547651453501460311464453065023517674240101535404"},
+    {8, 10, "5371767641542405410103566475037501441453124453112426753114624517203737676242101"},
+    {9, 6, "56635350206753014463540137417624201537324245146714512"},
+    {9, 8, "53536056277145424236010356510426757241106317636721063731047176723624201"},
+    {9, 10, "53771146666210537621005327640354731176762420101537176764154172424101035356744247333144122"},
+    {10, 5, "7635123633762136721742420353736424230673511424514"},
+    {10, 6, "53626735350124260675130464535006553014623367142157624241036"},
+    {10, 7, "536513767236214600067631323645721573003646303764242103537324246750601"},
+    {10, 8, "7721362353606513746730032472457235142337672362424172101535367604720267350620510"},
+    {10, 9, "73745626315177101044641451363647312631176742420103537324246306767145353102053676724112214"},
+    {10, 10, "767653531454242013673266011136667111441176650373003645104675046357241132176762424101035373242463063"},
+};
+
+const char* findBlockTour(size_t width, size_t height) {
+    for (const auto& tour : BLOCK_TOURS) {
+        if (tour.width == width && tour.height == height) {
+            return tour.moves;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+DivideAndConquerSolver::DivideAndConquerSolver(Board& board)
+    : board_(board)
+{
+    path_.reserve(board.size());
+}
+
+bool DivideAndConquerSolver::supports(size_t width, size_t height) noexcept {
+    return width >= 5 && height >= 5 && (width % 2 == 0 || height % 2 == 0);
+}
+
+std::vector<size_t> DivideAndConquerSolver::splitSide(size_t length) {
+    std::vector<size_t> parts;
+    size_t even = length;
+
+    // An odd side gets exactly one odd block
+    if (length % 2 == 1) {
+        if (length <= 9) {
+            return {length};
+        }
+        parts.push_back(5);
+        even -= 5;
+    }
+
+    // Split the even remainder (>= 6) into 8s, adjusted with 6s or a 10
+    size_t eights = even / 8;
+    switch (even % 8) {
+        case 2:
+            parts.push_back(10);
+            --eights;
+            break;
+        case 4:
+            parts.push_back(6);
+            parts.push_back(6);
+            --eights;
+            break;
+        case 6:
+            parts.push_back(6);
+            break;
+        default:
+            break;
+    }
+    parts.insert(parts.end(), eights, 8);
+    return parts;
+}
+
+void DivideAndConquerSolver::placeBlock(size_t row, size_t col, size_t width, size_t height) {
+    const auto& graph = board_.graph();
+    const char* moves = findBlockTour(width, height);
+
+    int r = static_cast<int>(row);
+    int c = static_cast<int>(col);
+    const auto first = static_cast<uint32_t>(graph.toIndex(r, c));
+    uint32_t previous = first;
+
+    for (const char* move = moves; *move != '\0'; ++move) {
+        const Move& offset = Board::KNIGHT_MOVES[*move - '0'];
+        r += offset.row;
+        c += offset.col;
+        const auto current = static_cast<uint32_t>(graph.toIndex(r, c));
+        links_[previous][1] = current;
+        links_[current][0] = previous;
+        previous = current;
+    }
+
+    // Close the block's cycle
+    links_[previous][1] = first;
+    links_[first][0] = previous;
+}
+
+void DivideAndConquerSolver::relink(uint32_t square, uint32_t from, uint32_t to) {
+    auto& link = links_[square];
+    link[link[0] == from ? 0 : 1] = to;
+}
+
+void DivideAndConquerSolver::join(uint32_t a, uint32_t b, uint32_t c, uint32_t d) {
+    relink(a, b, c);
+    relink(b, a, d);
+    relink(c, d, a);
+    relink(d, c, b);
+}
+
+bool DivideAndConquerSolver::solve(int startRow, int startCol, TourType type) {
+    (void)type;  // A closed tour satisfies both tour types
+    path_.clear();
+
+    if (!supports(board_.width(), board_.height()) || !board_.isValid(startRow, startCol)) {
+        return false;
+    }
+
+    const auto& graph = board_.graph();
+    auto square = [&graph](size_t row, size_t col) {
+        return static_cast<uint32_t>(graph.toIndex(static_cast<int>(row), static_cast<int>(col)));
+    };
+
+    // Tile the board with precomputed block tours
+    const auto widths = splitSide(board_.width());
+    const auto heights = splitSide(board_.height());
+    links_.resize(board_.size());
+
+    for (size_t row = 0, i = 0; i < heights.size(); row += heights[i++]) {
+        for (size_t col = 0, j = 0; j < widths.size(); col += widths[j++]) {
+            placeBlock(row, col, widths[j], heights[i]);
+        }
+    }
+
+    // Join the top block row left to right across each vertical seam
+    for (size_t j = 1, seam = widths[0]; j < widths.size(); seam += widths[j++]) {
+        join(square(1, seam - 2), square(3, seam - 1), square(0, seam), square(2, seam + 1));
+    }
+
+    // Join every block column top to bottom across each horizontal seam
+    for (size_t col = 0, j = 0; j < widths.size(); col += widths[j++]) {
+        for (size_t i = 1, seam = heights[0]; i < heights.size(); seam += heights[i++]) {
+            join(square(seam - 2, col + 1), square(seam - 1, col + 3), square(seam, col), square(seam + 1, col + 2));
+        }
+    }
+
+    // Walk the cycle from the start square and number the board
+    board_.clear();
+    uint32_t previous = square(startRow, startCol);
+    uint32_t current = links_[previous][0];
+    path_.push_back(graph.toMove(previous));
+    board_.setByIndex(previous, 1);
+
+    while (current != square(startRow, startCol)) {
+        path_.push_back(graph.toMove(current));
+        board_.setByIndex(current, static_cast<int>(path_.size()));
+        uint32_t next = links_[current][0] == previous ? links_[current][1] : links_[current][0];
+        previous = current;
+        current = next;
+    }
+
+    return path_.size() == board_.size();
+}
@@ -1,8 +1,12 @@
 #include "Exporter.h"
+#include "OutputBuffer.h"
+#include "PngWriter.h"
+#include "TourFile.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
 #include <iostream>
 #include <sstream>
-#include <iomanip>
-#include <cmath>
 
 bool Exporter::exportToJSON(const Solver& solver, const Board& board, const std::string& filename) {
     std::ofstream file(filename);
@@ -13,37 +17,192 @@ bool Exporter::exportToJSON(const Solver& solver, const Board& board, const std:
 
     const auto& path = solver.getPath();
     auto stats = solver.getPathStatistics();
+    OutputBuffer out(file);
+
+    out << "{\n";
+    out << "  \"board\": {\n";
+    out << "    \"width\": " << board.width() << ",\n";
+    out << "    \"height\": " << board.height() << "\n";
+    out << "  },\n";
+    out << "  \"solution\": {\n";
+    out << "    \"moves\": " << path.size() << ",\n";
+    out << "    \"backtracks\": " << solver.getBacktrackCount() << ",\n";
+    out << "    \"path\": [\n";
 
-    file << "{\n";
-    file << "  \"board\": {\n";
-    file << "    \"width\": " << board.width() << ",\n";
-    file << "    \"height\": " << board.height() << "\n";
-    file << "  },\n";
-    file << "  \"solution\": {\n";
-    file << "    \"moves\": " << path.size() << ",\n";
-    file << "    \"backtracks\": " << solver.getBacktrackCount() << ",\n";
-    file << "    \"path\": [\n";
-    
     for (size_t i = 0; i < path.size(); ++i) {
-        file << "      {\"row\": " << path[i].row << ", \"col\": " << path[i].col << "}";
-        if (i < path.size() - 1) file << ",";
-        file << "\n";
-    }
-    
-    file << "    ],\n";
-    file << "    \"statistics\": {\n";
-    file << "      \"cornerVisits\": " << stats.cornerVisits << ",\n";
-    file << "      \"edgeVisits\": " << stats.edgeVisits << ",\n";
-    file << "      \"centerVisits\": " << stats.centerVisits << ",\n";
-    file << "      \"avgDistanceFromCenter\": " << stats.averageDistanceFromCenter << "\n";
-    file << "    }\n";
-    file << "  }\n";
-    file << "}\n";
-
-    file.close();
-    return true;
+        out << "      {\"row\": " << path[i].row << ", \"col\": " << path[i].col << "}";
+        if (i < path.size() - 1) out << ',';
+        out << '\n';
+    }
+
+    out << "    ],\n";
+    out << "    \"statistics\": {\n";
+    out << "      \"cornerVisits\": " << stats.cornerVisits << ",\n";
+    out << "      \"edgeVisits\": " << stats.edgeVisits << ",\n";
+    out << "      \"centerVisits\": " << stats.centerVisits << ",\n";
+    out << "      \"avgDistanceFromCenter\": " << OutputBuffer::general(stats.averageDistanceFromCenter) << "\n";
+    out << "    }\n";
+    out << "  }\n";
+    out << "}\n";
+
+    return out.flush();
 }
 
+namespace {
+
+struct Rgba {
+    uint8_t r, g, b, a;
+};
+
+constexpr Rgba LIGHT_SQUARE = {0xF0, 0xD9, 0xB5, 0xFF};
+constexpr Rgba DARK_SQUARE = {0xB5, 0x88, 0x63, 0xFF};
+constexpr Rgba START_COLOR = {0x4C, 0xAF, 0x50, 0xFF};
+constexpr Rgba END_COLOR = {0xF4, 0x43, 0x36, 0xFF};
+
+/**
+ * @brief RGBA image the PNG export draws into
+ */
+class Raster {
+public:
+    Raster(size_t width, size_t height) : width_(width), height_(height), pixels_(width * height) {}
+
+    [[nodiscard]] const uint8_t* data() const { return reinterpret_cast<const uint8_t*>(pixels_.data()); }
+
+    /**
+     * @brief Fill the image with a checkerboard of cellSize-pixel squares
+     */
+    void fillCheckerboard(size_t cellSize) {
+        // Two row patterns (light first, dark first), each copied down its cell rows
+        for (size_t y = 0; y < height_; ++y) {
+            Rgba* row = pixels_.data() + y * width_;
+            if (y >= 2 * cellSize) {
+                std::copy_n(row - 2 * cellSize * width_, width_, row);
+                continue;
+            }
+            if (y % cellSize != 0) {
+                std::copy_n(row - width_, width_, row);
+                continue;
+            }
+            const bool lightFirst = (y / cellSize) % 2 == 0;
+            for (size_t x = 0; x < width_; ++x) {
+                row[x] = ((x / cellSize) % 2 == 0) == lightFirst ? LIGHT_SQUARE : DARK_SQUARE;
+            }
+        }
+    }
+
+    /**
+     * @brief Draw a line with a square brush (Bresenham)
+     *
+     * One-pixel lines between points inside the image take a fast path
+     * without clipping; this is every line on boards with small cells.
+     */
+    void drawLine(int x0, int y0, int x1, int y1, int thickness, Rgba color) {
+        const int dx = std::abs(x1 - x0);
+        const int dy = -std::abs(y1 - y0);
+        const int sx = x0 < x1 ? 1 : -1;
+        const int sy = y0 < y1 ? 1 : -1;
+        const bool plain = thickness == 1 && contains(x0, y0) && contains(x1, y1);
+        int error = dx + dy;
+        while (true) {
+            if (plain) {
+                pixels_[static_cast<size_t>(y0) * width_ + static_cast<size_t>(x0)] = color;
+            } else {
+                fillSquare(x0 - thickness / 2, y0 - thickness / 2, thickness, color);
+            }
+            if (x0 == x1 && y0 == y1) {
+                return;
+            }
+            const int twice = 2 * error;
+            if (twice >= dy) {
+                error += dy;
+                x0 += sx;
+            }
+            if (twice <= dx) {
+                error += dx;
+                y0 += sy;
+            }
+        }
+    }
+
+    /**
+     * @brief Fill a size x size square, clipped to the image
+     */
+    void fillSquare(int x, int y, int size, Rgba color) {
+        const int left = std::max(x, 0);
+        const int right = std::min(x + size, static_cast<int>(width_));
+        const int top = std::max(y, 0);
+        const int bottom = std::min(y + size, static_cast<int>(height_));
+        for (int row = top; row < bottom; ++row) {
+            std::fill(pixels_.begin() + row * static_cast<ptrdiff_t>(width_) + left,
+                      pixels_.begin() + row * static_cast<ptrdiff_t>(width_) + right, color);
+        }
+    }
+
+    /**
+     * @brief Fill a disc, clipped to the image
+     */
+    void fillDisc(int cx, int cy, int radius, Rgba color) {
+        for (int dy = -radius; dy <= radius; ++dy) {
+            const int span = static_cast<int>(std::sqrt(static_cast<double>(radius * radius - dy * dy)));
+            fillSquareRow(cx - span, cx + span + 1, cy + dy, color);
+        }
+    }
+
+private:
+    size_t width_;
+    size_t height_;
+    std::vector<Rgba> pixels_;
+
+    [[nodiscard]] bool contains(int x, int y) const {
+        return x >= 0 && y >= 0 && x < static_cast<int>(width_) && y < static_cast<int>(height_);
+    }
+
+    void fillSquareRow(int left, int right, int y, Rgba color) {
+        if (y < 0 || y >= static_cast<int>(height_)) {
+            return;
+        }
+        left = std::max(left, 0);
+        right = std::min(right, static_cast<int>(width_));
+        if (left < right) {
+            std::fill(pixels_.begin() + y * static_cast<ptrdiff_t>(width_) + left,
+                      pixels_.begin() + y * static_cast<ptrdiff_t>(width_) + right, color);
+        }
+    }
+};
+
+/**
+ * @brief Color ramp from one color to another in fixed steps (16.16 fixed point)
+ */
+class Gradient {
+public:
+    Gradient(Rgba from, Rgba to, uint32_t steps)
+        : value_{fixed(from.r), fixed(from.g), fixed(from.b)}
+        , delta_{(fixed(to.r) - fixed(from.r)) / static_cast<int32_t>(steps),
+                 (fixed(to.g) - fixed(from.g)) / static_cast<int32_t>(steps),
+                 (fixed(to.b) - fixed(from.b)) / static_cast<int32_t>(steps)}
+    {
+    }
+
+    [[nodiscard]] Rgba color() const {
+        return {static_cast<uint8_t>(value_[0] >> 16), static_cast<uint8_t>(value_[1] >> 16),
+                static_cast<uint8_t>(value_[2] >> 16), 0xFF};
+    }
+
+    void step() {
+        for (size_t i = 0; i < 3; ++i) {
+            value_[i] += delta_[i];
+        }
+    }
+
+private:
+    int32_t value_[3];
+    int32_t delta_[3];
+
+    static int32_t fixed(uint8_t channel) { return static_cast<int32_t>(channel) << 16; }
+};
+
+}  // namespace
+
 bool Exporter::exportToSVG(const Solver& solver, const Board& board, const std::string& filename) {
     std::ofstream file(filename);
     if (!file.is_open()) {
@@ -56,75 +215,192 @@ bool Exporter::exportToSVG(const Solver& solver, const Board& board, const std::
     const int padding = 40;
     const int width = board.width() * cellSize + 2 * padding;
     const int height = board.height() * cellSize + 2 * padding;
+    OutputBuffer out(file);
 
     // SVG header
-    file << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
-    file << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" << width 
-         << "\" height=\"" << height << "\">\n";
-    
+    out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    out << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" << width
+        << "\" height=\"" << height << "\">\n";
+
     // Title
-    file << "  <text x=\"" << width/2 << "\" y=\"25\" text-anchor=\"middle\" "
-         << "font-family=\"Arial\" font-size=\"18\" font-weight=\"bold\">"
-         << "Knight's Tour Solution (" << board.width() << "×" << board.height() << ")"
-         << "</text>\n\n";
+    out << "  <text x=\"" << width / 2 << "\" y=\"25\" text-anchor=\"middle\" "
+        << "font-family=\"Arial\" font-size=\"18\" font-weight=\"bold\">"
+        << "Knight's Tour Solution (" << board.width() << "×" << board.height() << ")"
+        << "</text>\n\n";
 
     // Draw chessboard
-    file << "  <!-- Chessboard -->\n";
+    out << "  <!-- Chessboard -->\n";
     for (int row = 0; row < static_cast<int>(board.height()); ++row) {
         for (int col = 0; col < static_cast<int>(board.width()); ++col) {
             int x = padding + col * cellSize;
             int y = padding + row * cellSize;
             bool isLight = (row + col) % 2 == 0;
-            file << "  <rect x=\"" << x << "\" y=\"" << y 
-                 << "\" width=\"" << cellSize << "\" height=\"" << cellSize 
-                 << "\" fill=\"" << (isLight ? "#f0d9b5" : "#b58863") << "\"/>\n";
+            out << "  <rect x=\"" << x << "\" y=\"" << y
+                << "\" width=\"" << cellSize << "\" height=\"" << cellSize
+                << "\" fill=\"" << (isLight ? "#f0d9b5" : "#b58863") << "\"/>\n";
         }
     }
 
     // Draw path lines
-    file << "\n  <!-- Path lines -->\n";
-    file << "  <g stroke=\"#2196F3\" stroke-width=\"3\" stroke-opacity=\"0.6\" "
-         << "fill=\"none\" stroke-linecap=\"round\">\n";
-    
-    for (size_t i = 0; i < path.size() - 1; ++i) {
+    out << "\n  <!-- Path lines -->\n";
+    out << "  <g stroke=\"#2196F3\" stroke-width=\"3\" stroke-opacity=\"0.6\" "
+        << "fill=\"none\" stroke-linecap=\"round\">\n";
+
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
         int x1 = padding + path[i].col * cellSize + cellSize / 2;
         int y1 = padding + path[i].row * cellSize + cellSize / 2;
         int x2 = padding + path[i + 1].col * cellSize + cellSize / 2;
         int y2 = padding + path[i + 1].row * cellSize + cellSize / 2;
-        
-        file << "    <line x1=\"" << x1 << "\" y1=\"" << y1 
-             << "\" x2=\"" << x2 << "\" y2=\"" << y2 << "\"/>\n";
+
+        out << "    <line x1=\"" << x1 << "\" y1=\"" << y1
+            << "\" x2=\"" << x2 << "\" y2=\"" << y2 << "\"/>\n";
     }
-    file << "  </g>\n";
+    out << "  </g>\n";
 
     // Draw move numbers
-    file << "\n  <!-- Move numbers -->\n";
-    for (size_t i = 0; i < path.size(); ++i) {
-        int x = padding + path[i].col * cellSize + cellSize / 2;
-        int y = padding + path[i].row * cellSize + cellSize / 2;
-        
-        // Circle background
-        std::string fillColor = (i == 0) ? "#4CAF50" : (i == path.size() - 1) ? "#F44336" : "#FFF";
-        file << "  <circle cx=\"" << x << "\" cy=\"" << y << "\" r=\"18\" "
-             << "fill=\"" << fillColor << "\" stroke=\"#333\" stroke-width=\"2\"/>\n";
-        
-        // Move number
-        file << "  <text x=\"" << x << "\" y=\"" << (y + 5) 
-             << "\" text-anchor=\"middle\" font-family=\"Arial\" "
-             << "font-size=\"14\" font-weight=\"bold\" fill=\"#333\">"
-             << (i + 1) << "</text>\n";
+    out << "\n  <!-- Move numbers -->\n";
+    writeSVGLabels(out, path, cellSize, padding);
+
+    writeSVGLegend(out, height);
+
+    out << "</svg>\n";
+    return out.flush();
+}
+
+bool Exporter::exportToSVGLevelOfDetail(const Solver& solver, const Board& board, const std::string& filename,
+                                        size_t labelLimit) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open file: " << filename << "\n";
+        return false;
     }
 
-    // Legend
-    file << "\n  <!-- Legend -->\n";
-    int legendY = height - 15;
-    file << "  <circle cx=\"20\" cy=\"" << legendY << "\" r=\"8\" fill=\"#4CAF50\"/>\n";
-    file << "  <text x=\"35\" y=\"" << (legendY + 4) << "\" font-family=\"Arial\" font-size=\"12\">Start</text>\n";
-    file << "  <circle cx=\"90\" cy=\"" << legendY << "\" r=\"8\" fill=\"#F44336\"/>\n";
-    file << "  <text x=\"105\" y=\"" << (legendY + 4) << "\" font-family=\"Arial\" font-size=\"12\">End</text>\n";
+    const auto& path = solver.getPath();
+    const int cellSize = 60;
+    const int padding = 40;
+    const int width = board.width() * cellSize + 2 * padding;
+    const int height = board.height() * cellSize + 2 * padding;
+
+    // Drawing coordinates are the same as exportToSVG; only the displayed size shrinks
+    const int longest = std::max(width, height);
+    const int displayWidth = longest > MAX_SVG_DISPLAY_SIZE
+        ? std::max(1, static_cast<int>(static_cast<long long>(width) * MAX_SVG_DISPLAY_SIZE / longest)) : width;
+    const int displayHeight = longest > MAX_SVG_DISPLAY_SIZE
+        ? std::max(1, static_cast<int>(static_cast<long long>(height) * MAX_SVG_DISPLAY_SIZE / longest)) : height;
+    OutputBuffer out(file);
+
+    // SVG header
+    out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    out << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" << displayWidth
+        << "\" height=\"" << displayHeight << "\" viewBox=\"0 0 " << width << ' ' << height << "\">\n";
+
+    // Title
+    out << "  <text x=\"" << width / 2 << "\" y=\"25\" text-anchor=\"middle\" "
+        << "font-family=\"Arial\" font-size=\"18\" font-weight=\"bold\">"
+        << "Knight's Tour Solution (" << board.width() << "×" << board.height() << ")"
+        << "</text>\n\n";
+
+    // Chessboard: one rectangle tiled with a light square and two dark ones
+    out << "  <!-- Chessboard -->\n";
+    out << "  <defs>\n";
+    out << "    <pattern id=\"squares\" x=\"" << padding << "\" y=\"" << padding
+        << "\" width=\"" << 2 * cellSize << "\" height=\"" << 2 * cellSize
+        << "\" patternUnits=\"userSpaceOnUse\">\n";
+    out << "      <rect width=\"" << 2 * cellSize << "\" height=\"" << 2 * cellSize << "\" fill=\"#f0d9b5\"/>\n";
+    out << "      <rect x=\"" << cellSize << "\" width=\"" << cellSize << "\" height=\"" << cellSize
+        << "\" fill=\"#b58863\"/>\n";
+    out << "      <rect y=\"" << cellSize << "\" width=\"" << cellSize << "\" height=\"" << cellSize
+        << "\" fill=\"#b58863\"/>\n";
+    out << "    </pattern>\n";
+    out << "  </defs>\n";
+    out << "  <rect x=\"" << padding << "\" y=\"" << padding
+        << "\" width=\"" << board.width() * cellSize << "\" height=\"" << board.height() * cellSize
+        << "\" fill=\"url(#squares)\"/>\n";
 
-    file << "</svg>\n";
-    file.close();
+    // Path: absolute start, then one relative lineto pair per move
+    out << "\n  <!-- Path lines -->\n";
+    if (!path.empty()) {
+        out << "  <path stroke=\"#2196F3\" stroke-width=\"3\" stroke-opacity=\"0.6\" "
+            << "fill=\"none\" stroke-linecap=\"round\" stroke-linejoin=\"round\" d=\"M"
+            << padding + path[0].col * cellSize + cellSize / 2 << ' '
+            << padding + path[0].row * cellSize + cellSize / 2 << "l";
+
+        constexpr size_t MOVES_PER_LINE = 16;
+        for (size_t i = 1; i < path.size(); ++i) {
+            const int dx = (path[i].col - path[i - 1].col) * cellSize;
+            const int dy = (path[i].row - path[i - 1].row) * cellSize;
+
+            // A minus sign separates numbers on its own
+            if (i > 1 && (i - 1) % MOVES_PER_LINE == 0) {
+                out << '\n';
+            } else if (i > 1 && dx >= 0) {
+                out << ' ';
+            }
+            out << dx;
+            if (dy >= 0) {
+                out << ' ';
+            }
+            out << dy;
+        }
+        out << "\"/>\n";
+    }
+
+    if (board.size() <= labelLimit) {
+        out << "\n  <!-- Move numbers -->\n";
+        writeSVGLabels(out, path, cellSize, padding);
+    } else if (!path.empty()) {
+        // Too many squares to label: mark the start and end only
+        out << "\n  <!-- Start and end -->\n";
+        const Move& first = path.front();
+        const Move& last = path.back();
+        out << "  <circle cx=\"" << padding + first.col * cellSize + cellSize / 2
+            << "\" cy=\"" << padding + first.row * cellSize + cellSize / 2 << "\" r=\"18\" "
+            << "fill=\"#4CAF50\" stroke=\"#333\" stroke-width=\"2\"/>\n";
+        out << "  <circle cx=\"" << padding + last.col * cellSize + cellSize / 2
+            << "\" cy=\"" << padding + last.row * cellSize + cellSize / 2 << "\" r=\"18\" "
+            << "fill=\"#F44336\" stroke=\"#333\" stroke-width=\"2\"/>\n";
+    }
+
+    writeSVGLegend(out, height);
+
+    out << "</svg>\n";
+    return out.flush();
+}
+
+bool Exporter::exportToPNG(const Solver& solver, const Board& board, const std::string& filename) {
+    const auto& path = solver.getPath();
+    const size_t longest = std::max(board.width(), board.height());
+    const size_t cellSize = std::clamp(MAX_PNG_SIZE / longest, size_t{2}, MAX_PNG_CELL_SIZE);
+    const int cell = static_cast<int>(cellSize);
+
+    Raster raster(board.width() * cellSize, board.height() * cellSize);
+    raster.fillCheckerboard(cellSize);
+
+    // Path, colored from START_COLOR to END_COLOR by move index
+    const int thickness = std::max(1, cell / 12);
+    Gradient gradient(START_COLOR, END_COLOR, static_cast<uint32_t>(path.size() > 1 ? path.size() - 1 : 1));
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
+        raster.drawLine(path[i].col * cell + cell / 2, path[i].row * cell + cell / 2,
+                        path[i + 1].col * cell + cell / 2, path[i + 1].row * cell + cell / 2,
+                        thickness, gradient.color());
+        gradient.step();
+    }
+
+    // Start and end markers: discs on large cells, whole cells on small ones
+    if (!path.empty()) {
+        for (const auto& [square, color] : {std::pair{path.front(), START_COLOR}, std::pair{path.back(), END_COLOR}}) {
+            if (cell >= 8) {
+                raster.fillDisc(square.col * cell + cell / 2, square.row * cell + cell / 2, cell * 3 / 10, color);
+            } else {
+                raster.fillSquare(square.col * cell, square.row * cell, cell, color);
+            }
+        }
+    }
+
+    if (!PngWriter::write(filename, raster.data(), board.width() * cellSize, board.height() * cellSize)) {
+        std::cerr << "Failed to write file: " << filename << "\n";
+        return false;
+    }
     return true;
 }
 
@@ -137,50 +413,85 @@ bool Exporter::exportToText(const Solver& solver, const Board& board, const std:
 
     const auto& path = solver.getPath();
     auto stats = solver.getPathStatistics();
+    OutputBuffer out(file);
+
+    out << "KNIGHT'S TOUR SOLUTION\n";
+    out << "======================\n\n";
+    out << "Board Size: " << board.width() << " × " << board.height() << "\n";
+    out << "Total Moves: " << path.size() << "\n";
+    out << "Backtracks: " << solver.getBacktrackCount() << "\n\n";
 
-    file << "KNIGHT'S TOUR SOLUTION\n";
-    file << "======================\n\n";
-    file << "Board Size: " << board.width() << " × " << board.height() << "\n";
-    file << "Total Moves: " << path.size() << "\n";
-    file << "Backtracks: " << solver.getBacktrackCount() << "\n\n";
-
-    file << "STATISTICS\n";
-    file << "----------\n";
-    file << "Corner Visits: " << stats.cornerVisits << "\n";
-    file << "Edge Visits: " << stats.edgeVisits << "\n";
-    file << "Center Visits: " << stats.centerVisits << "\n";
-    file << "Avg Distance from Center: " << std::fixed << std::setprecision(2) 
-         << stats.averageDistanceFromCenter << "\n\n";
-
-    file << "MOVE SEQUENCE\n";
-    file << "-------------\n";
+    out << "STATISTICS\n";
+    out << "----------\n";
+    out << "Corner Visits: " << stats.cornerVisits << "\n";
+    out << "Edge Visits: " << stats.edgeVisits << "\n";
+    out << "Center Visits: " << stats.centerVisits << "\n";
+    out << "Avg Distance from Center: " << OutputBuffer::fixed(stats.averageDistanceFromCenter, 2) << "\n\n";
+
+    out << "MOVE SEQUENCE\n";
+    out << "-------------\n";
     for (size_t i = 0; i < path.size(); ++i) {
-        file << "Move " << std::setw(3) << (i + 1) << ": ("
-             << std::setw(2) << path[i].row << ", " 
-             << std::setw(2) << path[i].col << ")\n";
+        out << "Move " << OutputBuffer::padded(i + 1, 3) << ": ("
+            << OutputBuffer::padded(path[i].row, 2) << ", "
+            << OutputBuffer::padded(path[i].col, 2) << ")\n";
     }
 
-    file << "\nBOARD VISUALIZATION\n";
-    file << "-------------------\n";
-    
+    out << "\nBOARD VISUALIZATION\n";
+    out << "-------------------\n";
+
     // Print board with move numbers
-    std::vector<std::vector<int>> boardGrid(board.height(), 
-                                             std::vector<int>(board.width(), 0));
+    std::vector<int> boardGrid(board.size(), 0);
     for (size_t i = 0; i < path.size(); ++i) {
-        boardGrid[path[i].row][path[i].col] = i + 1;
+        boardGrid[static_cast<size_t>(path[i].row) * board.width() + static_cast<size_t>(path[i].col)] =
+            static_cast<int>(i + 1);
     }
 
     for (size_t row = 0; row < board.height(); ++row) {
         for (size_t col = 0; col < board.width(); ++col) {
-            file << std::setw(4) << boardGrid[row][col];
+            out << OutputBuffer::padded(boardGrid[row * board.width() + col], 4);
         }
-        file << "\n";
+        out << '\n';
     }
 
-    file.close();
+    return out.flush();
+}
+
+bool Exporter::exportToBinary(const Solver& solver, const Board& board, const std::string& filename) {
+    if (!TourFile::write(filename, solver.getPath(), board.width(), board.height(),
+                         solver.getTourType(), solver.getBacktrackCount())) {
+        std::cerr << "Failed to write file: " << filename << "\n";
+        return false;
+    }
     return true;
 }
 
+void Exporter::writeSVGLabels(OutputBuffer& out, const std::vector<Move>& path, int cellSize, int padding) {
+    for (size_t i = 0; i < path.size(); ++i) {
+        int x = padding + path[i].col * cellSize + cellSize / 2;
+        int y = padding + path[i].row * cellSize + cellSize / 2;
+
+        // Circle background
+        const char* fillColor = (i == 0) ? "#4CAF50" : (i == path.size() - 1) ? "#F44336" : "#FFF";
+        out << "  <circle cx=\"" << x << "\" cy=\"" << y << "\" r=\"18\" "
+            << "fill=\"" << fillColor << "\" stroke=\"#333\" stroke-width=\"2\"/>\n";
+
+        // Move number
+        out << "  <text x=\"" << x << "\" y=\"" << (y + 5)
+            << "\" text-anchor=\"middle\" font-family=\"Arial\" "
+            << "font-size=\"14\" font-weight=\"bold\" fill=\"#333\">"
+            << (i + 1) << "</text>\n";
+    }
+}
+
+void Exporter::writeSVGLegend(OutputBuffer& out, int height) {
+    out << "\n  <!-- Legend -->\n";
+    int legendY = height - 15;
+    out << "  <circle cx=\"20\" cy=\"" << legendY << "\" r=\"8\" fill=\"#4CAF50\"/>\n";
+    out << "  <text x=\"35\" y=\"" << (legendY + 4) << "\" font-family=\"Arial\" font-size=\"12\">Start</text>\n";
+    out << "  <circle cx=\"90\" cy=\"" << legendY << "\" r=\"8\" fill=\"#F44336\"/>\n";
+    out << "  <text x=\"105\" y=\"" << (legendY + 4) << "\" font-family=\"Arial\" font-size=\"12\">End</text>\n";
+}
+
 std::string Exporter::escapeJSON(const std::string& str) {
     std::ostringstream oss;
     for (char c : str) {
@@ -197,3 +508,4 @@ std::string Exporter::escapeJSON(const std::string& str) {
     }
     return oss.str();
 }
+
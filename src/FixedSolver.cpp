@@ -0,0 +1,30 @@
+#include "FixedSolver.h"
+
+namespace {
+
+template<size_t N>
+bool solveFixed(Solver& solver, int startRow, int startCol, TourType type) {
+    // Solver state is ~N*N*20 bytes; keep it off the caller's stack
+    static thread_local FixedSolver<N, N> fixed;
+    if (!fixed.solve(startRow, startCol, type)) {
+        solver.setUnsolved(startRow, startCol, type, fixed.getBacktrackCount());
+        return false;
+    }
+    return solver.setSolution(fixed.getPath(), type, fixed.getBacktrackCount());
+}
+
+}  // namespace
+
+std::optional<bool> solveSpecialized(Solver& solver, size_t width, size_t height,
+                                     int startRow, int startCol, TourType type) {
+    if (width != height) {
+        return std::nullopt;
+    }
+
+    switch (width) {
+        case 8:  return solveFixed<8>(solver, startRow, startCol, type);
+        case 10: return solveFixed<10>(solver, startRow, startCol, type);
+        case 12: return solveFixed<12>(solver, startRow, startCol, type);
+        default: return std::nullopt;
+    }
+}
@@ -0,0 +1,47 @@
+#include "KnightGraph.h"
+#include <map>
+#include <mutex>
+#include <utility>
+
+KnightGraph::KnightGraph(size_t width, size_t height)
+    : width_(width)
+    , height_(height)
+{
+    const int rows = static_cast<int>(height);
+    const int cols = static_cast<int>(width);
+
+    offsets_.reserve(size() + 1);
+    neighbors_.reserve(size() * 8);
+    offsets_.push_back(0);
+
+    for (int row = 0; row < rows; ++row) {
+        for (int col = 0; col < cols; ++col) {
+            for (const auto& move : Board::KNIGHT_MOVES) {
+                int newRow = row + move.row;
+                int newCol = col + move.col;
+                if (newRow >= 0 && newRow < rows && newCol >= 0 && newCol < cols) {
+                    neighbors_.push_back(static_cast<uint32_t>(toIndex(newRow, newCol)));
+                }
+            }
+            offsets_.push_back(static_cast<uint32_t>(neighbors_.size()));
+        }
+    }
+    neighbors_.shrink_to_fit();
+}
+
+std::shared_ptr<const KnightGraph> KnightGraph::get(size_t width, size_t height) {
+    static std::mutex mutex;
+    static std::map<std::pair<size_t, size_t>, std::weak_ptr<const KnightGraph>> cache;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (auto graph = cache[{width, height}].lock()) {
+        return graph;
+    }
+
+    // Forget sizes whose tables have been freed
+    std::erase_if(cache, [](const auto& entry) { return entry.second.expired(); });
+
+    std::shared_ptr<const KnightGraph> graph(new KnightGraph(width, height));
+    cache[{width, height}] = graph;
+    return graph;
+}
@@ -0,0 +1,177 @@
+#include "ParallelSolver.h"
+#include "TourFeasibility.h"
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace {
+
+/**
+ * @brief Task deque owned by one worker
+ *
+ * The owner pops from the front, thieves steal from the back, so the owner
+ * works through its tasks best first while thieves take the tasks it would
+ * reach last.
+ */
+struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<size_t> tasks;   // Indices into the task prefix list
+
+    std::optional<size_t> popFront() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (tasks.empty()) {
+            return std::nullopt;
+        }
+        size_t task = tasks.front();
+        tasks.pop_front();
+        return task;
+    }
+
+    std::optional<size_t> stealBack() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (tasks.empty()) {
+            return std::nullopt;
+        }
+        size_t task = tasks.back();
+        tasks.pop_back();
+        return task;
+    }
+};
+
+}  // namespace
+
+ParallelSolver::ParallelSolver(Board& board, size_t threadCount)
+    : board_(board)
+    , threadCount_(threadCount)
+    , splitDepth_(0)
+    , checkFeasibility_(true)
+    , backtrackCount_(0)
+    , taskCount_(0)
+    , stealCount_(0)
+{
+    if (threadCount_ == 0) {
+        threadCount_ = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+std::vector<std::vector<Move>> ParallelSolver::splitTasks(int startRow, int startCol, TourType type) const {
+    Board scratch(board_.width(), board_.height());
+    Solver expander(scratch);
+
+    std::vector<std::vector<Move>> tasks;
+    tasks.push_back({Move{startRow, startCol}});
+    const size_t targetTasks = threadCount_ * TASKS_PER_THREAD;
+    const size_t maxDepth = splitDepth_ > 0 ? splitDepth_ : MAX_AUTO_SPLIT_DEPTH;
+
+    // Expand one level at a time, keeping serial search order
+    for (size_t depth = 0; depth < maxDepth; ++depth) {
+        if (splitDepth_ == 0 && tasks.size() >= targetTasks) {
+            break;
+        }
+
+        std::vector<std::vector<Move>> next;
+        bool expanded = false;
+        for (auto& prefix : tasks) {
+            auto candidates = expander.candidateMoves(prefix, type);
+            if (candidates.empty()) {
+                // Finished tour or dead end: keep it, solveFrom settles it at once
+                next.push_back(std::move(prefix));
+                continue;
+            }
+            expanded = true;
+            for (const Move& move : candidates) {
+                next.push_back(prefix);
+                next.back().push_back(move);
+            }
+        }
+        tasks = std::move(next);
+        if (!expanded) {
+            break;
+        }
+    }
+    return tasks;
+}
+
+bool ParallelSolver::solve(int startRow, int startCol, TourType type) {
+    path_.clear();
+    backtrackCount_ = 0;
+    taskCount_ = 0;
+    stealCount_ = 0;
+
+    if (!board_.isValid(startRow, startCol) ||
+        (checkFeasibility_ &&
+         !TourFeasibility::isPossible(board_.width(), board_.height(), startRow, startCol, type))) {
+        return false;
+    }
+
+    const auto tasks = splitTasks(startRow, startCol, type);
+    taskCount_ = tasks.size();
+
+    // Deal tasks round-robin so every worker starts near the front of the order
+    std::vector<WorkerQueue> queues(threadCount_);
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        queues[i % threadCount_].tasks.push_back(i);
+    }
+
+    // Set once a tour is found (or the caller cancels); polled by every solver
+    std::stop_source found;
+    std::stop_callback forwardStop(stopToken_, [&found] { found.request_stop(); });
+    std::mutex resultMutex;
+    std::atomic<size_t> backtracks{0};
+    std::atomic<size_t> steals{0};
+
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(threadCount_);
+
+        for (size_t id = 0; id < threadCount_; ++id) {
+            workers.emplace_back([&, id] {
+                Board board(board_.width(), board_.height());
+                Solver solver(board);
+                SolveOptions options;
+                options.stopToken = found.get_token();
+                options.checkFeasibility = false;  // The start was checked above
+                solver.setOptions(options);
+
+                while (!found.stop_requested()) {
+                    std::optional<size_t> task = queues[id].popFront();
+                    for (size_t k = 1; !task && k < threadCount_; ++k) {
+                        task = queues[(id + k) % threadCount_].stealBack();
+                        if (task) {
+                            steals.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                    if (!task) {
+                        break;  // Tasks are never added, so every deque is drained
+                    }
+
+                    bool solved = solver.solveFrom(tasks[*task], type);
+                    backtracks.fetch_add(solver.getBacktrackCount(), std::memory_order_relaxed);
+                    if (solved) {
+                        std::lock_guard<std::mutex> lock(resultMutex);
+                        if (path_.empty()) {
+                            path_ = solver.getPath();
+                            found.request_stop();
+                        }
+                    }
+                }
+            });
+        }
+    }  // jthreads join here
+
+    backtrackCount_ = backtracks.load();
+    stealCount_ = steals.load();
+    if (path_.empty()) {
+        return false;
+    }
+
+    // Number the caller's board along the tour
+    board_.clear();
+    for (size_t i = 0; i < path_.size(); ++i) {
+        board_.set(path_[i].row, path_[i].col, static_cast<int>(i + 1));
+    }
+    return true;
+}
@@ -0,0 +1,52 @@
+#include "PathCodec.h"
+
+int PathCodec::direction(const Move& from, const Move& to) {
+    const int dr = to.row - from.row;
+    const int dc = to.col - from.col;
+    for (size_t k = 0; k < 8; ++k) {
+        if (Board::KNIGHT_MOVES[k].row == dr && Board::KNIGHT_MOVES[k].col == dc) {
+            return static_cast<int>(k);
+        }
+    }
+    return -1;
+}
+
+bool PathCodec::encode(const std::vector<Move>& path, std::vector<uint8_t>& out) {
+    out.assign(encodedSize(path.size()), 0);
+
+    size_t bit = 0;
+    for (size_t i = 1; i < path.size(); ++i, bit += BITS_PER_MOVE) {
+        const int k = direction(path[i - 1], path[i]);
+        if (k < 0) {
+            return false;
+        }
+        // A 3-bit code spans at most two bytes
+        const unsigned code = static_cast<unsigned>(k) << (bit & 7);
+        out[bit >> 3] |= static_cast<uint8_t>(code);
+        if ((bit & 7) > 8 - BITS_PER_MOVE) {
+            out[(bit >> 3) + 1] |= static_cast<uint8_t>(code >> 8);
+        }
+    }
+    return true;
+}
+
+bool PathCodec::decode(const uint8_t* data, size_t size, const Move& start, size_t moveCount,
+                       std::vector<Move>& path) {
+    path.clear();
+    if (moveCount == 0) {
+        return true;
+    }
+    if (size < encodedSize(moveCount)) {
+        return false;
+    }
+
+    path.reserve(moveCount);
+    path.push_back(start);
+    Move current = start;
+    for (size_t i = 1; i < moveCount; ++i) {
+        const Move& step = Board::KNIGHT_MOVES[code(data, i - 1)];
+        current = {current.row + step.row, current.col + step.col};
+        path.push_back(current);
+    }
+    return true;
+}
@@ -0,0 +1,353 @@
+#include "PngWriter.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <memory>
+
+namespace {
+
+constexpr size_t WINDOW_SIZE = 32768;
+constexpr size_t MIN_MATCH = 4;
+constexpr size_t MAX_MATCH = 258;
+constexpr unsigned HASH_BITS = 15;
+
+// CRC_TABLES[0] is the usual byte table; table k advances a byte through k more zero bytes (slicing-by-8)
+constexpr std::array<std::array<uint32_t, 256>, 8> CRC_TABLES = [] {
+    std::array<std::array<uint32_t, 256>, 8> tables{};
+    for (uint32_t n = 0; n < 256; ++n) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; ++k) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        tables[0][n] = c;
+    }
+    for (uint32_t n = 0; n < 256; ++n) {
+        for (size_t k = 1; k < 8; ++k) {
+            tables[k][n] = tables[0][tables[k - 1][n] & 0xFF] ^ (tables[k - 1][n] >> 8);
+        }
+    }
+    return tables;
+}();
+
+// Fixed Huffman code of a literal/length symbol, bit-reversed for LSB-first output
+struct Code {
+    uint16_t bits;
+    uint8_t length;
+};
+
+constexpr uint16_t reverseBits(uint16_t value, unsigned length) {
+    uint16_t result = 0;
+    for (unsigned i = 0; i < length; ++i) {
+        result = static_cast<uint16_t>((result << 1) | ((value >> i) & 1));
+    }
+    return result;
+}
+
+constexpr std::array<Code, 288> FIXED_CODES = [] {
+    std::array<Code, 288> codes{};
+    for (unsigned symbol = 0; symbol < 288; ++symbol) {
+        uint16_t value;
+        unsigned length;
+        if (symbol < 144) {
+            value = static_cast<uint16_t>(0x30 + symbol);
+            length = 8;
+        } else if (symbol < 256) {
+            value = static_cast<uint16_t>(0x190 + symbol - 144);
+            length = 9;
+        } else if (symbol < 280) {
+            value = static_cast<uint16_t>(symbol - 256);
+            length = 7;
+        } else {
+            value = static_cast<uint16_t>(0xC0 + symbol - 280);
+            length = 8;
+        }
+        codes[symbol] = {reverseBits(value, length), static_cast<uint8_t>(length)};
+    }
+    return codes;
+}();
+
+// LSB-first bit packer. Every put stores the whole 64-bit buffer and advances
+// by the completed bytes, so there is no branch; the output needs 8 bytes of slack.
+class BitWriter {
+public:
+    explicit BitWriter(uint8_t* out) : out_(out) {}
+
+    void put(uint64_t bits, unsigned count) {
+        buffer_ |= bits << count_;
+        count_ += count;
+        if constexpr (std::endian::native == std::endian::little) {
+            std::memcpy(out_ + size_, &buffer_, sizeof(buffer_));
+        } else {
+            for (size_t i = 0; i < sizeof(buffer_); ++i) {
+                out_[size_ + i] = static_cast<uint8_t>(buffer_ >> (8 * i));
+            }
+        }
+        size_ += count_ >> 3;
+        buffer_ >>= count_ & ~7u;
+        count_ &= 7;
+    }
+
+    /**
+     * @brief Flush the remaining bits (padded to a byte)
+     * @return Total bytes written
+     */
+    size_t finish() {
+        if (count_ > 0) {
+            out_[size_++] = static_cast<uint8_t>(buffer_);
+            buffer_ = 0;
+            count_ = 0;
+        }
+        return size_;
+    }
+
+private:
+    uint8_t* out_;
+    size_t size_ = 0;
+    uint64_t buffer_ = 0;
+    unsigned count_ = 0;
+};
+
+// Literals are packed up to 6 codes (54 bits) per put, to shorten the bit buffer's dependency chain
+void putLiterals(BitWriter& bits, const uint8_t* literals, size_t count) {
+    while (count > 0) {
+        const size_t group = std::min<size_t>(count, 6);
+        uint64_t packed = 0;
+        unsigned length = 0;
+        for (size_t i = 0; i < group; ++i) {
+            const Code& code = FIXED_CODES[literals[i]];
+            packed |= uint64_t{code.bits} << length;
+            length += code.length;
+        }
+        bits.put(packed, length);
+        literals += group;
+        count -= group;
+    }
+}
+
+// A match is at most 31 bits: length code, its extra bits, distance code, its extra bits
+void putMatch(BitWriter& bits, size_t length, size_t distance) {
+    uint64_t packed;
+    unsigned used;
+
+    // Length symbol 257-285 and its extra bits
+    const auto x = static_cast<uint32_t>(length - 3);
+    if (x < 8 || x == 255) {
+        const Code& code = FIXED_CODES[x == 255 ? 285 : 257 + x];
+        packed = code.bits;
+        used = code.length;
+    } else {
+        const unsigned log = static_cast<unsigned>(std::bit_width(x)) - 1;
+        const Code& code = FIXED_CODES[257 + 4 * (log - 1) + ((x >> (log - 2)) & 3)];
+        packed = code.bits | uint64_t{x & ((1u << (log - 2)) - 1)} << code.length;
+        used = code.length + log - 2;
+    }
+
+    // Distance code 0-29 (fixed 5-bit codes) and its extra bits
+    const auto d = static_cast<uint32_t>(distance - 1);
+    if (d < 4) {
+        packed |= uint64_t{reverseBits(static_cast<uint16_t>(d), 5)} << used;
+        used += 5;
+    } else {
+        const unsigned log = static_cast<unsigned>(std::bit_width(d)) - 1;
+        const auto symbol = static_cast<uint16_t>(2 * log + ((d >> (log - 1)) & 1));
+        packed |= uint64_t{reverseBits(symbol, 5)} << used;
+        packed |= uint64_t{d & ((1u << (log - 1)) - 1)} << (used + 5);
+        used += 5 + log - 1;
+    }
+    bits.put(packed, used);
+}
+
+uint32_t load32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+uint32_t hash32(uint32_t value) {
+    return (value * 2654435761u) >> (32 - HASH_BITS);
+}
+
+void putBigEndian(std::vector<uint8_t>& out, uint32_t value) {
+    out.push_back(static_cast<uint8_t>(value >> 24));
+    out.push_back(static_cast<uint8_t>(value >> 16));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+void putChunk(std::vector<uint8_t>& out, const char type[4], const uint8_t* data, size_t size) {
+    putBigEndian(out, static_cast<uint32_t>(size));
+    const size_t typeAt = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data, data + size);
+    putBigEndian(out, PngWriter::crc32(out.data() + typeAt, size + 4));
+}
+
+}  // namespace
+
+uint32_t PngWriter::crc32(const uint8_t* data, size_t size, uint32_t crc) noexcept {
+    const auto& t = CRC_TABLES;
+    uint32_t c = ~crc;
+    for (; size >= 8; data += 8, size -= 8) {
+        const uint32_t low = c ^ (uint32_t{data[0]} | uint32_t{data[1]} << 8 |
+                                  uint32_t{data[2]} << 16 | uint32_t{data[3]} << 24);
+        c = t[7][low & 0xFF] ^ t[6][(low >> 8) & 0xFF] ^ t[5][(low >> 16) & 0xFF] ^ t[4][low >> 24] ^
+            t[3][data[4]] ^ t[2][data[5]] ^ t[1][data[6]] ^ t[0][data[7]];
+    }
+    for (; size > 0; ++data, --size) {
+        c = t[0][(c ^ *data) & 0xFF] ^ (c >> 8);
+    }
+    return ~c;
+}
+
+uint32_t PngWriter::adler32(const uint8_t* data, size_t size, uint32_t adler) noexcept {
+    // Per block: a gains the byte sum, b gains n * a plus each byte weighted by
+    // how many sums it is still part of. Both sums vectorize. 5552 is the
+    // largest block whose weighted sum fits 32 bits.
+    constexpr size_t NMAX = 5552;
+    uint64_t a = adler & 0xFFFF;
+    uint64_t b = adler >> 16;
+    while (size > 0) {
+        const size_t chunk = size < NMAX ? size : NMAX;
+        uint32_t sum = 0;
+        uint32_t weighted = 0;
+        for (size_t i = 0; i < chunk; ++i) {
+            sum += data[i];
+            weighted += static_cast<uint32_t>(chunk - i) * data[i];
+        }
+        b = (b + chunk * a + weighted) % 65521;
+        a = (a + sum) % 65521;
+        data += chunk;
+        size -= chunk;
+    }
+    return static_cast<uint32_t>((b << 16) | a);
+}
+
+void PngWriter::compress(const uint8_t* data, size_t size, std::vector<uint8_t>& out) {
+    // zlib header: deflate, 32 KB window, no preset dictionary
+    out.push_back(0x78);
+    out.push_back(0x01);
+
+    // Fixed Huffman codes are at most 9 bits per input byte (literals)
+    const auto packed = std::make_unique_for_overwrite<uint8_t[]>(size + size / 8 + 64);
+    BitWriter bits(packed.get());
+    bits.put(1, 1);  // BFINAL
+    bits.put(1, 2);  // BTYPE = fixed Huffman
+
+    // Most recent position of each 4-byte hash (+1, so 0 means none)
+    std::vector<uint32_t> head(size_t{1} << HASH_BITS, 0);
+
+    size_t pos = 0;
+    size_t literalStart = 0;
+    while (pos + MIN_MATCH <= size) {
+        const uint32_t word = load32(data + pos);
+        uint32_t& slot = head[hash32(word)];
+        const size_t candidate = slot;
+        slot = static_cast<uint32_t>(pos + 1);
+
+        if (candidate == 0 || pos - (candidate - 1) > WINDOW_SIZE || load32(data + candidate - 1) != word) {
+            ++pos;
+            continue;
+        }
+
+        const uint8_t* match = data + candidate - 1;
+        const size_t limit = std::min(MAX_MATCH, size - pos);
+        size_t length = MIN_MATCH;
+        while (length + 8 <= limit) {
+            uint64_t a;
+            uint64_t b;
+            std::memcpy(&a, match + length, sizeof(a));
+            std::memcpy(&b, data + pos + length, sizeof(b));
+            if (a != b) {
+                // Little-endian loads: the lowest differing bit is in the first differing byte
+                if constexpr (std::endian::native == std::endian::little) {
+                    length += static_cast<size_t>(std::countr_zero(a ^ b)) / 8;
+                }
+                break;
+            }
+            length += 8;
+        }
+        while (length < limit && match[length] == data[pos + length]) {
+            ++length;
+        }
+
+        putLiterals(bits, data + literalStart, pos - literalStart);
+        putMatch(bits, length, pos - (candidate - 1));
+        pos += length;
+        literalStart = pos;
+
+        // Remember where the match ended so the next one can continue from it
+        if (pos + MIN_MATCH <= size) {
+            head[hash32(load32(data + pos - 1))] = static_cast<uint32_t>(pos);
+        }
+    }
+    putLiterals(bits, data + literalStart, size - literalStart);
+
+    const Code& end = FIXED_CODES[256];
+    bits.put(end.bits, end.length);
+    out.insert(out.end(), packed.get(), packed.get() + bits.finish());
+
+    putBigEndian(out, adler32(data, size));
+}
+
+std::vector<uint8_t> PngWriter::encode(const uint8_t* rgba, size_t width, size_t height) {
+    std::vector<uint8_t> png;
+    const size_t rowBytes = width * 4;
+    if (width == 0 || height == 0 || width > 0x7FFFFFFF || height > 0x7FFFFFFF ||
+        (rowBytes + 1) * height >= (size_t{1} << 31)) {
+        return png;
+    }
+
+    // Scanlines: filter byte, then the row. Row 0 is stored as is, the rest with Up
+    std::vector<uint8_t> scanlines((rowBytes + 1) * height);
+    for (size_t y = 0; y < height; ++y) {
+        uint8_t* line = scanlines.data() + y * (rowBytes + 1);
+        const uint8_t* row = rgba + y * rowBytes;
+        if (y == 0) {
+            line[0] = 0;
+            std::memcpy(line + 1, row, rowBytes);
+            continue;
+        }
+        const uint8_t* above = row - rowBytes;
+        line[0] = 2;
+        for (size_t i = 0; i < rowBytes; ++i) {
+            line[i + 1] = static_cast<uint8_t>(row[i] - above[i]);
+        }
+    }
+
+    std::vector<uint8_t> idat;
+    compress(scanlines.data(), scanlines.size(), idat);
+
+    static constexpr uint8_t SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    png.reserve(sizeof(SIGNATURE) + 25 + idat.size() + 12 + 12);
+    png.insert(png.end(), SIGNATURE, SIGNATURE + sizeof(SIGNATURE));
+
+    std::vector<uint8_t> header;
+    putBigEndian(header, static_cast<uint32_t>(width));
+    putBigEndian(header, static_cast<uint32_t>(height));
+    header.push_back(8);  // Bit depth
+    header.push_back(6);  // Color type: RGBA
+    header.push_back(0);  // Compression: deflate
+    header.push_back(0);  // Filter method: adaptive
+    header.push_back(0);  // Interlace: none
+
+    putChunk(png, "IHDR", header.data(), header.size());
+    putChunk(png, "IDAT", idat.data(), idat.size());
+    putChunk(png, "IEND", nullptr, 0);
+    return png;
+}
+
+bool PngWriter::write(const std::string& filename, const uint8_t* rgba, size_t width, size_t height) {
+    const std::vector<uint8_t> png = encode(rgba, width, height);
+    if (png.empty()) {
+        return false;
+    }
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(png.data()), static_cast<std::streamsize>(png.size()));
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,95 @@
+#include "PortfolioSolver.h"
+#include <algorithm>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+PortfolioSolver::PortfolioSolver(Board& board, size_t threadCount)
+    : board_(board)
+    , backtrackCount_(0)
+    , winner_(-1)
+{
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    strategies_ = defaultStrategies(threadCount);
+}
+
+void PortfolioSolver::setStrategies(std::vector<PortfolioStrategy> strategies) {
+    if (strategies.empty()) {
+        throw std::invalid_argument("Portfolio needs at least one strategy");
+    }
+    strategies_ = std::move(strategies);
+}
+
+std::vector<PortfolioStrategy> PortfolioSolver::defaultStrategies(size_t threadCount) {
+    std::vector<PortfolioStrategy> strategies;
+    strategies.reserve(threadCount);
+
+    const TieBreak deterministic[] = {TieBreak::CENTER_FAR, TieBreak::CENTER_NEAR, TieBreak::MOVE_ORDER};
+    for (size_t i = 0; i < threadCount; ++i) {
+        if (i < std::size(deterministic)) {
+            strategies.push_back({deterministic[i], 0});
+        } else {
+            strategies.push_back({TieBreak::RANDOM, i});
+        }
+    }
+    return strategies;
+}
+
+bool PortfolioSolver::solve(int startRow, int startCol, TourType type) {
+    path_.clear();
+    backtrackCount_ = 0;
+    winner_ = -1;
+
+    if (!board_.isValid(startRow, startCol)) {
+        return false;
+    }
+
+    std::stop_source stopSource;
+    std::stop_callback forwardStop(stopToken_, [&stopSource] { stopSource.request_stop(); });
+    std::mutex resultMutex;
+
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(strategies_.size());
+
+        for (size_t i = 0; i < strategies_.size(); ++i) {
+            workers.emplace_back([&, i] {
+                // Each strategy searches its own board
+                Board board(board_.width(), board_.height());
+                Solver solver(board);
+                solver.setTieBreak(strategies_[i].tieBreak, strategies_[i].seed);
+                solver.setStopToken(stopSource.get_token());
+
+                const bool solved = solver.solve(startRow, startCol, type);
+
+                // First finisher wins and cancels everyone else
+                std::lock_guard<std::mutex> lock(resultMutex);
+                if (!solved) {
+                    if (winner_ < 0) {
+                        backtrackCount_ += solver.getBacktrackCount();
+                    }
+                    return;
+                }
+                if (winner_ < 0) {
+                    winner_ = static_cast<int>(i);
+                    path_ = solver.getPath();
+                    backtrackCount_ = solver.getBacktrackCount();
+                    stopSource.request_stop();
+                }
+            });
+        }
+    }  // jthreads join here
+
+    if (winner_ < 0) {
+        return false;
+    }
+
+    // Number the caller's board along the winning tour
+    board_.clear();
+    for (size_t i = 0; i < path_.size(); ++i) {
+        board_.set(path_[i].row, path_[i].col, static_cast<int>(i + 1));
+    }
+    return true;
+}
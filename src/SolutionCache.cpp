@@ -0,0 +1,174 @@
+#include "SolutionCache.h"
+#include "FixedSolver.h"
+#include "TourFile.h"
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+
+#if defined(_WIN32)
+#include <process.h>
+#define KNIGHTS_TOUR_GETPID _getpid
+#else
+#include <unistd.h>
+#define KNIGHTS_TOUR_GETPID getpid
+#endif
+
+size_t SolutionCache::KeyHash::operator()(const SolutionKey& key) const noexcept {
+    uint64_t hash = 1469598103934665603ULL;  // FNV-1a over the fields
+    for (uint64_t value : {static_cast<uint64_t>(key.width), static_cast<uint64_t>(key.height),
+                           static_cast<uint64_t>(key.startRow), static_cast<uint64_t>(key.startCol),
+                           static_cast<uint64_t>(key.type)}) {
+        hash = (hash ^ value) * 1099511628211ULL;
+    }
+    return static_cast<size_t>(hash);
+}
+
+SolutionCache::SolutionCache(size_t capacity, std::string directory)
+    : capacity_(std::max<size_t>(capacity, 1))
+    , directory_(std::move(directory))
+    , hits_(0)
+    , misses_(0)
+{
+}
+
+std::shared_ptr<const CachedSolution> SolutionCache::find(const SolutionKey& key) {
+    std::lock_guard lock(mutex_);
+
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        entries_.splice(entries_.begin(), entries_, it->second);
+        ++hits_;
+        return it->second->second;
+    }
+
+    auto solution = load(key);
+    if (solution) {
+        remember(key, solution);
+        ++hits_;
+    } else {
+        ++misses_;
+    }
+    return solution;
+}
+
+void SolutionCache::store(const SolutionKey& key, CachedSolution solution) {
+    auto shared = std::make_shared<const CachedSolution>(std::move(solution));
+    save(key, *shared);
+
+    std::lock_guard lock(mutex_);
+    remember(key, std::move(shared));
+}
+
+bool SolutionCache::solve(Solver& solver, size_t width, size_t height, int startRow, int startCol, TourType type,
+                          bool* hit, const SolveOptions& options) {
+    const SolutionKey key{width, height, startRow, startCol, type};
+
+    auto cached = find(key);
+    const bool replayed = cached && solver.setSolution(cached->path, type, cached->backtracks);
+    if (hit) {
+        *hit = replayed;
+    }
+    if (replayed) {
+        return true;
+    }
+
+    bool solved = false;
+    if (options.isLimited() || options.restartBacktracks > 0) {
+        solved = solver.solve(startRow, startCol, type, options) == SolveStatus::SOLVED;
+    } else if (auto specialized = solveSpecialized(solver, width, height, startRow, startCol, type)) {
+        solved = *specialized;
+    } else {
+        solved = solver.solve(startRow, startCol, type);
+    }
+    if (solved) {
+        store(key, {solver.getPath(), solver.getBacktrackCount()});
+    }
+    return solved;
+}
+
+size_t SolutionCache::getHitCount() const {
+    std::lock_guard lock(mutex_);
+    return hits_;
+}
+
+size_t SolutionCache::getMissCount() const {
+    std::lock_guard lock(mutex_);
+    return misses_;
+}
+
+size_t SolutionCache::size() const {
+    std::lock_guard lock(mutex_);
+    return entries_.size();
+}
+
+std::string SolutionCache::filePath(const SolutionKey& key) const {
+    if (directory_.empty()) {
+        return {};
+    }
+    std::string name = std::to_string(key.width) + "x" + std::to_string(key.height) + "-" +
+                       std::to_string(key.startRow) + "-" + std::to_string(key.startCol) +
+                       (key.type == TourType::CLOSED ? "-closed" : "-open") + ".kt";
+    return (std::filesystem::path(directory_) / name).string();
+}
+
+void SolutionCache::remember(const SolutionKey& key, std::shared_ptr<const CachedSolution> solution) {
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        it->second->second = std::move(solution);
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return;
+    }
+
+    entries_.emplace_front(key, std::move(solution));
+    index_[key] = entries_.begin();
+    if (entries_.size() > capacity_) {
+        index_.erase(entries_.back().first);
+        entries_.pop_back();
+    }
+}
+
+std::shared_ptr<const CachedSolution> SolutionCache::load(const SolutionKey& key) const {
+    const std::string path = filePath(key);
+    if (path.empty() || !std::filesystem::exists(path)) {
+        return nullptr;
+    }
+
+    try {
+        TourReader reader(path);
+
+        // Reject files for another key, with a partial path, or with corrupt moves
+        const Move start = reader.start();
+        if (reader.width() != key.width || reader.height() != key.height ||
+            start.row != key.startRow || start.col != key.startCol ||
+            reader.tourType() != key.type || reader.size() != key.width * key.height || !reader.verify()) {
+            return nullptr;
+        }
+
+        CachedSolution solution{reader.readAll(), static_cast<size_t>(reader.backtracks())};
+        return std::make_shared<const CachedSolution>(std::move(solution));
+    } catch (const std::exception&) {
+        return nullptr;  // Unreadable entries are misses
+    }
+}
+
+void SolutionCache::save(const SolutionKey& key, const CachedSolution& solution) const {
+    const std::string path = filePath(key);
+    if (path.empty()) {
+        return;
+    }
+
+    // Write next to the target and rename, so concurrent readers see either
+    // no file or a complete one. The temporary name is unique to this process
+    // and write, so writers of the same key never share a temporary file.
+    static std::atomic<uint64_t> writeCount{0};
+    std::error_code error;
+    std::filesystem::create_directories(directory_, error);
+    const std::string temporary = path + "." + std::to_string(KNIGHTS_TOUR_GETPID()) + "-" +
+                                  std::to_string(writeCount.fetch_add(1)) + ".tmp";
+    if (TourFile::write(temporary, solution.path, key.width, key.height, key.type, solution.backtracks)) {
+        std::filesystem::rename(temporary, path, error);
+    }
+    if (error || std::filesystem::exists(temporary)) {
+        std::filesystem::remove(temporary, error);  // Failed write or rename: leave no debris
+    }
+}
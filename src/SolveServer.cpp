@@ -0,0 +1,584 @@
+#include "SolveServer.h"
+#include "OutputBuffer.h"
+#include <bit>
+#include <cctype>
+#include <cstring>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+#if defined(__linux__)
+#define KNIGHTS_TOUR_HAVE_EPOLL 1
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+static_assert(std::endian::native == std::endian::little, "SolveServer frames are little-endian");
+static_assert(sizeof(SolveRequestHeader) == 24, "SolveRequestHeader must have no padding");
+
+namespace {
+
+// epoll ids of the listening socket and the wake-up eventfd; connections count up from FIRST_CONNECTION_ID
+constexpr uint64_t LISTEN_ID = 0;
+constexpr uint64_t WAKE_ID = 1;
+constexpr uint64_t FIRST_CONNECTION_ID = 2;
+
+// Most bytes read from one connection per readiness event, so one client cannot starve the rest
+constexpr size_t MAX_READ_PER_EVENT = size_t{1} << 18;
+
+// Flatten a JSON object of strings, integers and [int, int] pairs into a batch job line
+std::string jsonToJobLine(std::string_view text) {
+    size_t pos = 0;
+    auto skipSpace = [&] {
+        while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) {
+            ++pos;
+        }
+    };
+    auto expect = [&](char c) {
+        skipSpace();
+        if (pos >= text.size() || text[pos] != c) {
+            throw std::invalid_argument(std::string("expected '") + c + "' in JSON request");
+        }
+        ++pos;
+    };
+    auto parseString = [&] {
+        expect('"');
+        const size_t end = text.find('"', pos);
+        if (end == std::string_view::npos) {
+            throw std::invalid_argument("unterminated string in JSON request");
+        }
+        std::string_view value = text.substr(pos, end - pos);
+        for (char c : value) {
+            if (c == '\\' || std::isspace(static_cast<unsigned char>(c)) || static_cast<unsigned char>(c) < 0x20) {
+                throw std::invalid_argument("JSON strings must not contain escapes or whitespace");
+            }
+        }
+        pos = end + 1;
+        return value;
+    };
+    auto parseInteger = [&] {
+        skipSpace();
+        const size_t start = pos;
+        if (pos < text.size() && text[pos] == '-') {
+            ++pos;
+        }
+        while (pos < text.size() && std::isdigit(static_cast<unsigned char>(text[pos]))) {
+            ++pos;
+        }
+        if (pos == start) {
+            throw std::invalid_argument("expected a string, integer or [row, col] in JSON request");
+        }
+        return text.substr(start, pos - start);
+    };
+
+    std::string line;
+    expect('{');
+    skipSpace();
+    if (pos < text.size() && text[pos] == '}') {
+        ++pos;
+    } else {
+        while (true) {
+            line += parseString();
+            line += '=';
+            expect(':');
+            skipSpace();
+            if (pos < text.size() && text[pos] == '"') {
+                line += parseString();
+            } else if (pos < text.size() && text[pos] == '[') {
+                ++pos;
+                line += parseInteger();
+                expect(',');
+                line += ',';
+                line += parseInteger();
+                expect(']');
+            } else {
+                line += parseInteger();
+            }
+            line += ' ';
+
+            skipSpace();
+            if (pos < text.size() && text[pos] == ',') {
+                ++pos;
+                continue;
+            }
+            expect('}');
+            break;
+        }
+    }
+    skipSpace();
+    if (pos != text.size()) {
+        throw std::invalid_argument("unexpected text after the JSON request");
+    }
+    return line;
+}
+
+}  // namespace
+
+BatchJob SolveServer::parseRequest(const uint8_t* payload, size_t size) {
+    if (size >= sizeof(REQUEST_MAGIC) && std::memcmp(payload, REQUEST_MAGIC, sizeof(REQUEST_MAGIC)) == 0) {
+        if (size != sizeof(SolveRequestHeader)) {
+            throw std::invalid_argument("binary request must be " + std::to_string(sizeof(SolveRequestHeader)) +
+                                        " bytes");
+        }
+        SolveRequestHeader request;
+        std::memcpy(&request, payload, sizeof(request));
+        if (request.tourType > 1 || request.algorithm > 1 || request.format > 1) {
+            throw std::invalid_argument("binary request has an unknown tour type, algorithm or format");
+        }
+
+        BatchJob job;
+        job.width = request.width;
+        job.height = request.height;
+        job.startRow = request.startRow;
+        job.startCol = request.startCol;
+        job.type = request.tourType == 1 ? TourType::CLOSED : TourType::OPEN;
+        job.divide = request.algorithm == 1;
+        job.format = request.format == 1 ? BatchFormat::JSON : BatchFormat::BINARY;
+        SolverWorkspace::validate(job);
+        return job;
+    }
+
+    if (size == 0 || payload[0] != '{') {
+        throw std::invalid_argument("request must be a KTRQ header or a JSON object");
+    }
+    return BatchRunner::parseJob(jsonToJobLine(std::string_view(reinterpret_cast<const char*>(payload), size)),
+                                 BatchFormat::JSON);
+}
+
+void SolveServer::appendFrame(std::string_view payload, std::string& out) {
+    const auto length = static_cast<uint32_t>(payload.size());
+    char prefix[sizeof(length)];
+    std::memcpy(prefix, &length, sizeof(length));
+    out.append(prefix, sizeof(prefix));
+    out.append(payload);
+}
+
+std::string SolveServer::errorFrame(const std::string& message) {
+    std::string payload = "{\"error\":\"";
+    for (char c : message) {
+        if (c == '"' || c == '\\') {
+            payload += '\\';
+            payload += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            payload += ' ';
+        } else {
+            payload += c;
+        }
+    }
+    payload += "\"}\n";
+
+    std::string frame;
+    appendFrame(payload, frame);
+    return frame;
+}
+
+#ifdef KNIGHTS_TOUR_HAVE_EPOLL
+
+SolveServer::SolveServer(const std::string& socketPath, size_t threadCount)
+    : listenFd_(-1)
+    , epollFd_(-1)
+    , wakeFd_(-1)
+    , stopping_(false)
+    , nextConnectionId_(FIRST_CONNECTION_ID)
+    , requestCount_(0)
+    , connectionCount_(0)
+    , defaultTimeoutMillis_(0)
+    , inFlight_(0)
+{
+    auto fail = [this](const std::string& message) {
+        closeFds();
+        throw std::runtime_error(message);
+    };
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path)) {
+        fail("Socket path must be 1-" + std::to_string(sizeof(address.sun_path) - 1) + " characters");
+    }
+    std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+
+    // Replace a socket file left behind by a server that is gone, but never a live one
+    struct stat info {};
+    if (::stat(socketPath.c_str(), &info) == 0) {
+        if (!S_ISSOCK(info.st_mode)) {
+            fail(socketPath + " exists and is not a socket");
+        }
+        int probe = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        const bool live = probe >= 0 &&
+                          ::connect(probe, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+        if (probe >= 0) {
+            ::close(probe);
+        }
+        if (live) {
+            fail("Another server is listening on " + socketPath);
+        }
+        ::unlink(socketPath.c_str());
+    }
+
+    listenFd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listenFd_ < 0 || ::bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        fail("Cannot bind " + socketPath + ": " + std::strerror(errno));
+    }
+    socketPath_ = socketPath;  // Ours to remove from here on
+    if (::listen(listenFd_, SOMAXCONN) != 0) {
+        fail("Cannot listen on " + socketPath + ": " + std::strerror(errno));
+    }
+
+    epollFd_ = ::epoll_create1(EPOLL_CLOEXEC);
+    wakeFd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epollFd_ < 0 || wakeFd_ < 0) {
+        fail("Cannot create event loop: " + std::string(std::strerror(errno)));
+    }
+    epoll_event listenEvent{};
+    listenEvent.events = EPOLLIN;
+    listenEvent.data.u64 = LISTEN_ID;
+    epoll_event wakeEvent{};
+    wakeEvent.events = EPOLLIN;
+    wakeEvent.data.u64 = WAKE_ID;
+    if (::epoll_ctl(epollFd_, EPOLL_CTL_ADD, listenFd_, &listenEvent) != 0 ||
+        ::epoll_ctl(epollFd_, EPOLL_CTL_ADD, wakeFd_, &wakeEvent) != 0) {
+        fail("Cannot create event loop: " + std::string(std::strerror(errno)));
+    }
+
+    // Room in the queue for every solve in flight, so submit() never blocks the loop
+    pool_ = std::make_unique<SolverPool>(threadCount, MAX_IN_FLIGHT);
+}
+
+SolveServer::~SolveServer() {
+    for (auto& [id, connection] : connections_) {
+        connection.cancel.request_stop();
+    }
+    pool_.reset();  // Drain the cancelled solves while the completion queue still exists
+    for (auto& [id, connection] : connections_) {
+        ::close(connection.fd);
+    }
+    connections_.clear();
+    closeFds();
+}
+
+void SolveServer::closeFds() noexcept {
+    for (int* fd : {&listenFd_, &epollFd_, &wakeFd_}) {
+        if (*fd >= 0) {
+            ::close(*fd);
+            *fd = -1;
+        }
+    }
+    if (!socketPath_.empty()) {
+        ::unlink(socketPath_.c_str());
+        socketPath_.clear();
+    }
+}
+
+void SolveServer::wake() noexcept {
+    const uint64_t one = 1;
+    [[maybe_unused]] auto written = ::write(wakeFd_, &one, sizeof(one));
+}
+
+void SolveServer::stop() noexcept {
+    stopping_.store(true);
+    wake();
+}
+
+void SolveServer::run() {
+    epoll_event events[64];
+    while (!stopping_.load()) {
+        const int count = ::epoll_wait(epollFd_, events, static_cast<int>(std::size(events)), -1);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error("epoll_wait failed: " + std::string(std::strerror(errno)));
+        }
+
+        for (int i = 0; i < count; ++i) {
+            const uint64_t id = events[i].data.u64;
+            if (id == LISTEN_ID) {
+                acceptConnections();
+                continue;
+            }
+            if (id == WAKE_ID) {
+                uint64_t wakeups;
+                [[maybe_unused]] auto bytes = ::read(wakeFd_, &wakeups, sizeof(wakeups));
+                deliverCompletions();
+                continue;
+            }
+
+            auto it = connections_.find(id);
+            if (it == connections_.end()) {
+                continue;  // Closed earlier in this batch of events
+            }
+            Connection& connection = it->second;
+            if (events[i].events & (EPOLLHUP | EPOLLERR)) {
+                connection.failed = true;  // Peer is gone: nothing more can be sent
+            } else {
+                if (events[i].events & (EPOLLIN | EPOLLRDHUP)) {
+                    readFrom(id, connection);
+                }
+                writeTo(connection);
+                if (events[i].events & EPOLLOUT) {
+                    parseRequests(id, connection);  // Frames held back while the output was over its limit
+                    writeTo(connection);
+                }
+            }
+            update(id, connection);
+        }
+    }
+}
+
+void SolveServer::acceptConnections() {
+    while (true) {
+        const int fd = ::accept4(listenFd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            return;  // EAGAIN, or out of descriptors: retried on the next readiness event
+        }
+
+        const uint64_t id = nextConnectionId_++;
+        Connection& connection = connections_[id];
+        connection.fd = fd;
+        connection.events = EPOLLIN | EPOLLRDHUP;
+        epoll_event event{};
+        event.events = connection.events;
+        event.data.u64 = id;
+        if (::epoll_ctl(epollFd_, EPOLL_CTL_ADD, fd, &event) != 0) {
+            ::close(fd);
+            connections_.erase(id);
+            continue;
+        }
+        ++connectionCount_;
+    }
+}
+
+void SolveServer::readFrom(uint64_t id, Connection& connection) {
+    char chunk[1 << 16];
+    size_t total = 0;
+    while (!connection.readClosed && total < MAX_READ_PER_EVENT && acceptsRequests(connection)) {
+        const ssize_t bytes = ::recv(connection.fd, chunk, sizeof(chunk), 0);
+        if (bytes > 0) {
+            connection.input.append(chunk, static_cast<size_t>(bytes));
+            total += static_cast<size_t>(bytes);
+            parseRequests(id, connection);
+        } else if (bytes == 0) {
+            connection.readClosed = true;
+        } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            break;
+        } else if (errno != EINTR) {
+            connection.failed = true;
+            return;
+        }
+    }
+}
+
+void SolveServer::parseRequests(uint64_t id, Connection& connection) {
+    while (acceptsRequests(connection)) {
+        const size_t available = connection.input.size() - connection.inputOffset;
+        uint32_t length;
+        if (available < sizeof(length)) {
+            break;
+        }
+        std::memcpy(&length, connection.input.data() + connection.inputOffset, sizeof(length));
+        if (length > MAX_REQUEST_SIZE) {
+            // The next frame boundary is unknown: answer, then stop reading
+            connection.responses.emplace_back(errorFrame("request larger than " +
+                                                         std::to_string(MAX_REQUEST_SIZE) + " bytes"));
+            connection.readClosed = true;
+            connection.input.clear();
+            connection.inputOffset = 0;
+            break;
+        }
+        if (available < sizeof(length) + length) {
+            break;
+        }
+
+        const auto* payload = reinterpret_cast<const uint8_t*>(connection.input.data() + connection.inputOffset +
+                                                               sizeof(length));
+        connection.inputOffset += sizeof(length) + length;
+        const uint64_t sequence = connection.firstSequence + connection.responses.size();
+        try {
+            BatchJob job = parseRequest(payload, length);
+            if (job.timeoutMillis == 0) {
+                job.timeoutMillis = defaultTimeoutMillis_;
+            }
+            job.stopToken = connection.cancel.get_token();
+            pool_->submit(job, [this, id, sequence, job](SolveResult&& result) {
+                std::ostringstream text;
+                {
+                    OutputBuffer out(text);
+                    BatchRunner::writeResult(job, result.status, result.path, result.backtracks, result.micros,
+                                             out);
+                }
+                std::string frame;
+                appendFrame(text.view(), frame);
+                {
+                    std::lock_guard<std::mutex> lock(completionMutex_);
+                    completions_.push_back({id, sequence, std::move(frame)});
+                }
+                wake();
+            });
+            connection.responses.emplace_back();  // Filled in by deliverCompletions
+            ++inFlight_;
+        } catch (const std::invalid_argument& e) {
+            connection.responses.emplace_back(errorFrame(e.what()));
+        }
+    }
+
+    if (connection.inputOffset == connection.input.size()) {
+        connection.input.clear();
+        connection.inputOffset = 0;
+    } else if (connection.inputOffset >= MAX_READ_PER_EVENT) {
+        connection.input.erase(0, connection.inputOffset);
+        connection.inputOffset = 0;
+    }
+
+    // Queue the responses that are ready, in order
+    while (!connection.responses.empty() && connection.responses.front()) {
+        connection.output += *connection.responses.front();
+        connection.responses.pop_front();
+        ++connection.firstSequence;
+        ++requestCount_;
+    }
+}
+
+void SolveServer::deliverCompletions() {
+    std::vector<Completion> completions;
+    {
+        std::lock_guard<std::mutex> lock(completionMutex_);
+        completions.swap(completions_);
+    }
+    const bool wasFull = inFlight_ >= MAX_IN_FLIGHT;
+    inFlight_ -= completions.size();
+
+    for (auto& completion : completions) {
+        auto it = connections_.find(completion.connection);
+        if (it == connections_.end()) {
+            continue;  // Client left before its answer was ready
+        }
+        Connection& connection = it->second;
+        connection.responses[completion.sequence - connection.firstSequence] = std::move(completion.frame);
+    }
+
+    for (auto& completion : completions) {
+        auto it = connections_.find(completion.connection);
+        if (it == connections_.end()) {
+            continue;
+        }
+        parseRequests(it->first, it->second);  // Sends ready responses, then reads past a full pipeline
+        writeTo(it->second);
+        update(it->first, it->second);
+    }
+
+    // Connections held back by the server-wide limit may read again
+    if (wasFull && !completions.empty()) {
+        std::vector<uint64_t> ids;
+        ids.reserve(connections_.size());
+        for (const auto& [id, connection] : connections_) {
+            ids.push_back(id);
+        }
+        for (uint64_t id : ids) {
+            auto it = connections_.find(id);
+            if (it == connections_.end()) {
+                continue;
+            }
+            parseRequests(id, it->second);
+            writeTo(it->second);
+            update(id, it->second);
+        }
+    }
+}
+
+void SolveServer::writeTo(Connection& connection) {
+    while (connection.outputOffset < connection.output.size()) {
+        const ssize_t bytes = ::send(connection.fd, connection.output.data() + connection.outputOffset,
+                                     connection.output.size() - connection.outputOffset, MSG_NOSIGNAL);
+        if (bytes > 0) {
+            connection.outputOffset += static_cast<size_t>(bytes);
+        } else if (bytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            if (connection.outputOffset >= MAX_UNSENT_OUTPUT) {
+                // Drop the sent part, so a slow reader does not keep it alive
+                connection.output.erase(0, connection.outputOffset);
+                connection.outputOffset = 0;
+            }
+            return;
+        } else if (bytes < 0 && errno == EINTR) {
+            continue;
+        } else {
+            connection.failed = true;
+            return;
+        }
+    }
+    connection.output.clear();
+    connection.outputOffset = 0;
+}
+
+void SolveServer::update(uint64_t id, Connection& connection) {
+    const bool done = connection.readClosed && connection.responses.empty() && connection.output.empty();
+    if (connection.failed || done) {
+        closeConnection(id, connection);
+        return;
+    }
+
+    uint32_t wanted = 0;
+    if (!connection.readClosed && acceptsRequests(connection)) {
+        wanted |= EPOLLIN | EPOLLRDHUP;
+    }
+    if (!connection.output.empty()) {
+        wanted |= EPOLLOUT;
+    }
+    if (wanted != connection.events) {
+        epoll_event event{};
+        event.events = wanted;
+        event.data.u64 = id;
+        ::epoll_ctl(epollFd_, EPOLL_CTL_MOD, connection.fd, &event);
+        connection.events = wanted;
+    }
+}
+
+bool SolveServer::acceptsRequests(const Connection& connection) const noexcept {
+    return connection.responses.size() < MAX_PIPELINE_DEPTH && inFlight_ < MAX_IN_FLIGHT &&
+           connection.output.size() - connection.outputOffset <= MAX_UNSENT_OUTPUT;
+}
+
+void SolveServer::closeConnection(uint64_t id, Connection& connection) {
+    connection.cancel.request_stop();  // Nobody is left to answer
+    ::epoll_ctl(epollFd_, EPOLL_CTL_DEL, connection.fd, nullptr);
+    ::close(connection.fd);
+    connections_.erase(id);
+}
+
+#else
+
+SolveServer::SolveServer(const std::string&, size_t)
+    : listenFd_(-1)
+    , epollFd_(-1)
+    , wakeFd_(-1)
+    , stopping_(false)
+    , nextConnectionId_(FIRST_CONNECTION_ID)
+    , requestCount_(0)
+    , connectionCount_(0)
+    , defaultTimeoutMillis_(0)
+    , inFlight_(0)
+{
+    throw std::runtime_error("The solve server needs epoll (Linux)");
+}
+
+SolveServer::~SolveServer() = default;
+
+void SolveServer::closeFds() noexcept {}
+void SolveServer::wake() noexcept {}
+void SolveServer::stop() noexcept {}
+void SolveServer::run() {}
+void SolveServer::acceptConnections() {}
+void SolveServer::readFrom(uint64_t, Connection&) {}
+void SolveServer::parseRequests(uint64_t, Connection&) {}
+void SolveServer::deliverCompletions() {}
+void SolveServer::writeTo(Connection&) {}
+void SolveServer::update(uint64_t, Connection&) {}
+bool SolveServer::acceptsRequests(const Connection&) const noexcept { return false; }
+void SolveServer::closeConnection(uint64_t, Connection&) {}
+
+#endif
@@ -1,14 +1,138 @@
 #include "Solver.h"
+#include "DegreeKernels.h"
+#include "TourFeasibility.h"
 #include <algorithm>
+#include <cstdlib>
 
 Solver::Solver(Board& board)
     : board_(board)
+    , degree_(board.cellCount(), 0)
+    , visited_(DegreeKernels::bitsetWords(board.cellCount()), 0)
+    , emptyVisited_(DegreeKernels::bitsetWords(board.cellCount()), 0)
+    , centerDistance_(board.cellCount(), 0)
+    , frames_(board.size())
     , backtrackCount_(0)
     , startRow_(0)
     , startCol_(0)
     , tourType_(TourType::OPEN)
+    , engine_(SearchEngine::ITERATIVE)
+    , tieBreak_(TieBreak::CENTER_FAR)
+    , seed_(0)
+    , rngState_(0)
+    , nodeCount_(0)
+    , nextLimitCheck_(0)
+    , status_(SolveStatus::UNSOLVABLE)
+    , restartCount_(0)
+    , runBacktrackLimit_(0)
+    , restartPending_(false)
 {
     path_.reserve(board.size());
+
+    // Border cells are permanently visited, like the board's SENTINEL cells
+    for (size_t cell = 0; cell < board.cellCount(); ++cell) {
+        const Move square = board.cellToMove(cell);
+        if (!board.isValid(square.row, square.col)) {
+            emptyVisited_[cell >> 6] |= uint64_t{1} << (cell & 63);
+        }
+    }
+
+    // Manhattan distance of every square from the board center, for tie-breaks
+    const int centerRow = static_cast<int>(board.height()) / 2;
+    const int centerCol = static_cast<int>(board.width()) / 2;
+    for (int row = 0; row < static_cast<int>(board.height()); ++row) {
+        for (int col = 0; col < static_cast<int>(board.width()); ++col) {
+            centerDistance_[board.cellIndex(row, col)] =
+                static_cast<uint16_t>(std::abs(row - centerRow) + std::abs(col - centerCol));
+        }
+    }
+}
+
+void Solver::setTieBreak(TieBreak policy, uint64_t seed) {
+    tieBreak_ = policy;
+    seed_ = seed;
+}
+
+uint64_t Solver::nextRandom() {
+    rngState_ ^= rngState_ >> 12;
+    rngState_ ^= rngState_ << 25;
+    rngState_ ^= rngState_ >> 27;
+    return rngState_ * 0x2545F4914F6CDD1DULL;
+}
+
+const char* solveStatusName(SolveStatus status) {
+    switch (status) {
+        case SolveStatus::SOLVED:           return "solved";
+        case SolveStatus::UNSOLVABLE:       return "unsolvable";
+        case SolveStatus::TIMED_OUT:        return "timed_out";
+        case SolveStatus::BUDGET_EXHAUSTED: return "budget_exhausted";
+        case SolveStatus::CANCELLED:        return "cancelled";
+    }
+    return "unknown";
+}
+
+uint64_t Solver::lubyTerm(uint64_t i) {
+    // Find the block 2^k - 1 >= i; its last term is 2^(k-1), earlier terms repeat the sequence
+    while (true) {
+        uint64_t k = 1;
+        while ((uint64_t{1} << k) - 1 < i) {
+            ++k;
+        }
+        if (i == (uint64_t{1} << k) - 1) {
+            return uint64_t{1} << (k - 1);
+        }
+        i -= (uint64_t{1} << (k - 1)) - 1;
+    }
+}
+
+bool Solver::checkLimits() {
+    if (wasStopped() || restartPending_) {
+        return true;  // Unwinding after a stop: every later move is refused too
+    }
+
+    if (options_.maxNodes > 0 && nodeCount_ > options_.maxNodes) {
+        status_ = SolveStatus::BUDGET_EXHAUSTED;
+    } else if (options_.maxBacktracks > 0 && backtrackCount_ >= options_.maxBacktracks) {
+        status_ = SolveStatus::BUDGET_EXHAUSTED;
+    } else if (options_.stopToken.stop_requested()) {
+        status_ = SolveStatus::CANCELLED;
+    } else if (options_.deadline != SolveOptions::Clock::time_point::max() &&
+               SolveOptions::Clock::now() >= options_.deadline) {
+        status_ = SolveStatus::TIMED_OUT;
+    }
+
+    if (wasStopped()) {
+        nextLimitCheck_ = 0;
+        return true;
+    }
+    if (runBacktrackLimit_ > 0 && backtrackCount_ >= runBacktrackLimit_) {
+        restartPending_ = true;
+        nextLimitCheck_ = 0;
+        return true;
+    }
+
+    // Poll again after the interval, exactly when the node budget runs out, or
+    // once as many moves have been made as backtracks remain (each backtrack
+    // undoes a move, so this overshoots the backtrack budget by at most the depth)
+    size_t interval = LIMIT_CHECK_INTERVAL;
+    if (options_.maxBacktracks > 0) {
+        interval = std::min(interval, options_.maxBacktracks - backtrackCount_);
+    }
+    if (runBacktrackLimit_ > 0) {
+        interval = std::min(interval, runBacktrackLimit_ - backtrackCount_);
+    }
+    nextLimitCheck_ = nodeCount_ + interval;
+    if (options_.maxNodes > 0) {
+        nextLimitCheck_ = std::min(nextLimitCheck_, options_.maxNodes + 1);
+    }
+    return false;
+}
+
+bool Solver::finishSearch(bool solved) {
+    if (solved) {
+        status_ = SolveStatus::SOLVED;
+    }
+    materializeBoard();
+    return solved;
 }
 
 void Solver::reset() {
@@ -20,57 +144,337 @@ void Solver::reset() {
 bool Solver::solve(int startRow, int startCol, TourType type) {
     // Validate starting position
     if (!board_.isValid(startRow, startCol)) {
+        status_ = SolveStatus::UNSOLVABLE;
         return false;
     }
 
-    // Reset state
-    board_.clear();
-    path_.clear();
+    // Place the knight at starting position
+    beginSearch(startRow, startCol, type);
+
+    // Tours that provably do not exist end here instead of exhausting the tree
+    if (options_.checkFeasibility &&
+        !TourFeasibility::isPossible(board_.width(), board_.height(), startRow, startCol, type)) {
+        return finishSearch(false);
+    }
+
+    // Start backtracking from move 2
+    const size_t start = board_.cellIndex(startRow, startCol);
+    if (options_.restartBacktracks > 0) {
+        return finishSearch(searchWithRestarts(start));
+    }
+    return finishSearch(search(start, 2));
+}
+
+bool Solver::searchWithRestarts(size_t cell) {
+    const TieBreak configured = tieBreak_;
+    bool solved = false;
+    for (uint64_t run = 1;; ++run) {
+        restartPending_ = false;
+        runBacktrackLimit_ = backtrackCount_ + lubyTerm(run) * options_.restartBacktracks;
+        nextLimitCheck_ = 0;  // Schedule the polls for the new allowance
+
+        solved = search(cell, 2);
+        if (solved || !restartPending_) {
+            break;  // Found a tour, exhausted the tree, or stopped on a limit
+        }
+
+        // Later runs break ties randomly, each from its own seed
+        ++restartCount_;
+        tieBreak_ = TieBreak::SHUFFLE;
+        rngState_ = ((seed_ + run * 0x9E3779B97F4A7C15ULL) ^ 0xD1B54A32D192ED03ULL) | 1;
+        resetToStart();
+    }
+
+    tieBreak_ = configured;
+    runBacktrackLimit_ = 0;
+    restartPending_ = false;
+    return solved;
+}
+
+SolveStatus Solver::solve(int startRow, int startCol, TourType type, const SolveOptions& options) {
+    options_ = options;
+    solve(startRow, startCol, type);
+    return status_;
+}
+
+bool Solver::solveFrom(const std::vector<Move>& prefix, TourType type) {
+    if (!replayPrefix(prefix, type)) {
+        status_ = SolveStatus::UNSOLVABLE;
+        return false;
+    }
+
+    if (options_.checkFeasibility &&
+        !TourFeasibility::isPossible(board_.width(), board_.height(), prefix[0].row, prefix[0].col, type)) {
+        return finishSearch(false);
+    }
+
+    const Move& last = prefix.back();
+    return finishSearch(search(board_.cellIndex(last.row, last.col), static_cast<int>(prefix.size()) + 1));
+}
+
+std::vector<Move> Solver::candidateMoves(const std::vector<Move>& prefix, TourType type) {
+    std::vector<Move> candidates;
+    bool replayed = replayPrefix(prefix, type);
+    materializeBoard();
+    if (!replayed || isSolution(static_cast<int>(prefix.size()) + 1)) {
+        return candidates;
+    }
+
+    // Same order and pruning as the first level of the search
+    const auto& offsets = board_.knightOffsets();
+    const Move& last = prefix.back();
+    SearchFrame frame;
+    orderCandidates(frame, board_.cellIndex(last.row, last.col));
+    for (uint8_t i = 0; i < frame.count; ++i) {
+        size_t move = frame.square + offsets[frame.slots[i]];
+        if (frame.count > 1 && createsDeadEnd(move)) {
+            continue;
+        }
+        candidates.push_back(board_.cellToMove(move));
+    }
+    return candidates;
+}
+
+void Solver::beginSearch(int startRow, int startCol, TourType type) {
+    // Reset state (the board itself is only written by materializeBoard)
     backtrackCount_ = 0;
     startRow_ = startRow;
     startCol_ = startCol;
     tourType_ = type;
+    nodeCount_ = 0;
+    nextLimitCheck_ = 0;  // Poll the limits before the first move
+    status_ = SolveStatus::UNSOLVABLE;
+    restartCount_ = 0;
+    // xorshift state must be nonzero; mix the seed so nearby seeds diverge
+    rngState_ = (seed_ ^ 0x9E3779B97F4A7C15ULL) | 1;
+
+    resetToStart();
+}
 
-    // Place the knight at starting position
-    board_.set(startRow, startCol, 1);
-    path_.push_back({startRow, startCol});
+void Solver::resetToStart() {
+    path_.clear();
+    visited_ = emptyVisited_;
 
-    // Start backtracking from move 2
-    return backtrack(startRow, startCol, 2);
+    // On an empty board every square's degree is its number of knight moves
+    DegreeKernels::computeDegreeMap(visited_, board_.width(), board_.height(), degree_);
+
+    makeMove(board_.cellIndex(startRow_, startCol_));
+}
+
+bool Solver::replayPrefix(const std::vector<Move>& prefix, TourType type) {
+    if (prefix.empty() || !board_.isValid(prefix[0].row, prefix[0].col)) {
+        return false;
+    }
+
+    beginSearch(prefix[0].row, prefix[0].col, type);
+    for (size_t i = 1; i < prefix.size(); ++i) {
+        const Move& from = prefix[i - 1];
+        const Move& to = prefix[i];
+        int dr = std::abs(to.row - from.row);
+        int dc = std::abs(to.col - from.col);
+        if (!board_.isValid(to.row, to.col) || !((dr == 1 && dc == 2) || (dr == 2 && dc == 1))) {
+            return false;
+        }
+        size_t cell = board_.cellIndex(to.row, to.col);
+        if (isVisited(cell)) {
+            return false;
+        }
+        makeMove(cell);
+    }
+    return true;
+}
+
+bool Solver::search(size_t cell, int moveNumber) {
+    if (engine_ == SearchEngine::RECURSIVE) {
+        return backtrack(cell, moveNumber);
+    }
+    return searchIterative(cell, moveNumber);
+}
+
+bool Solver::setSolution(const std::vector<Move>& path, TourType type, size_t backtracks) {
+    board_.clear();
+    path_ = path;
+    backtrackCount_ = backtracks;
+    tourType_ = type;
+
+    if (!validatePath()) {
+        path_.clear();
+        status_ = SolveStatus::UNSOLVABLE;
+        return false;
+    }
+    status_ = SolveStatus::SOLVED;
+
+    startRow_ = path_.front().row;
+    startCol_ = path_.front().col;
+    for (size_t i = 0; i < path_.size(); ++i) {
+        board_.set(path_[i].row, path_[i].col, static_cast<int>(i + 1));
+    }
+    return true;
+}
+
+void Solver::setUnsolved(int startRow, int startCol, TourType type, size_t backtracks) {
+    status_ = SolveStatus::UNSOLVABLE;
+    if (!board_.isValid(startRow, startCol)) {
+        return;  // As solve() does for an invalid start
+    }
+
+    startRow_ = startRow;
+    startCol_ = startCol;
+    tourType_ = type;
+    path_.assign(1, Move{startRow, startCol});
+    backtrackCount_ = backtracks;
+    restartCount_ = 0;
+    materializeBoard();
+}
+
+void Solver::materializeBoard() {
+    board_.clear();
+    for (size_t i = 0; i < path_.size(); ++i) {
+        board_.setByCell(board_.cellIndex(path_[i].row, path_[i].col), static_cast<int>(i + 1));
+    }
+}
+
+void Solver::makeMove(size_t cell) {
+    visited_[cell >> 6] |= uint64_t{1} << (cell & 63);
+    degree_[cell] += DegreeKernels::VISITED_FLAG;
+    path_.push_back(board_.cellToMove(cell));
+    // Border cells take the updates too, so no bounds checks are needed
+    for (ptrdiff_t offset : board_.knightOffsets()) {
+        --degree_[cell + offset];
+    }
+}
+
+void Solver::unmakeMove(size_t cell) {
+    visited_[cell >> 6] &= ~(uint64_t{1} << (cell & 63));
+    degree_[cell] -= DegreeKernels::VISITED_FLAG;
+    path_.pop_back();
+    for (ptrdiff_t offset : board_.knightOffsets()) {
+        ++degree_[cell + offset];
+    }
+}
+
+bool Solver::searchIterative(size_t cell, int moveNumber) {
+    if (isSolution(moveNumber)) {
+        return true;
+    }
+
+    const auto& offsets = board_.knightOffsets();
+    size_t depth = 0;
+    orderCandidates(frames_[0], cell);
+
+    while (true) {
+        SearchFrame& frame = frames_[depth];
+        bool descended = false;
+
+        // Try the next candidate of the current frame
+        while (frame.cursor < frame.count) {
+            size_t move = frame.square + offsets[frame.slots[frame.cursor++]];
+
+            // Early termination: skip moves that create dead ends
+            // (unless it's our only option)
+            if (frame.count > 1 && createsDeadEnd(move)) {
+                continue;
+            }
+
+            if (shouldStop()) {
+                return false;
+            }
+
+            makeMove(move);
+            ++moveNumber;
+            if (isSolution(moveNumber)) {
+                return true;  // Solution found!
+            }
+
+            orderCandidates(frames_[++depth], move);
+            descended = true;
+            break;
+        }
+
+        if (descended) {
+            continue;
+        }
+
+        // All candidates exhausted: no solution from the start position
+        if (depth == 0) {
+            return false;
+        }
+
+        // Undo the move that led to this frame (backtrack)
+        unmakeMove(frames_[depth].square);
+        --depth;
+        --moveNumber;
+        ++backtrackCount_;
+    }
 }
 
-bool Solver::backtrack(int row, int col, int moveNumber) {
+void Solver::orderCandidates(SearchFrame& frame, size_t cell) {
+    const auto& offsets = board_.knightOffsets();
+
+    frame.square = static_cast<uint32_t>(cell);
+    frame.count = 0;
+    frame.cursor = 0;
+
+    // Insertion sort by key: stable, so equal keys keep KNIGHT_MOVES order
+    uint32_t keys[8];
+    for (uint8_t slot = 0; slot < 8; ++slot) {
+        const size_t target = cell + offsets[slot];
+        if (isVisited(target)) {
+            continue;  // Visited, or off the board (border cell)
+        }
+        uint32_t key = moveKey(target);
+        uint8_t j = frame.count++;
+        for (; j > 0 && keys[j - 1] > key; --j) {
+            keys[j] = keys[j - 1];
+            frame.slots[j] = frame.slots[j - 1];
+        }
+        keys[j] = key;
+        frame.slots[j] = slot;
+    }
+}
+
+bool Solver::backtrack(size_t cell, int moveNumber) {
     // Check if we've visited all squares
     if (isSolution(moveNumber)) {
         return true;
     }
 
     // Get all valid unvisited moves from current position
-    auto validMoves = board_.getValidMoves(row, col, true);
+    StaticSquareList validMoves;
+    for (ptrdiff_t offset : board_.knightOffsets()) {
+        if (!isVisited(cell + offset)) {
+            validMoves.push_back(static_cast<uint32_t>(cell + offset));
+        }
+    }
 
     // Apply Warnsdorff's heuristic: sort moves by degree (ascending)
     sortMoves(validMoves);
 
     // Try each valid move
-    for (const auto& move : validMoves) {
+    for (uint32_t move : validMoves) {
         // Early termination: skip moves that create dead ends
         // (unless it's our only option)
-        if (validMoves.size() > 1 && createsDeadEnd(move, moveNumber)) {
+        if (validMoves.size() > 1 && createsDeadEnd(move)) {
             continue;  // Skip this move - it would isolate a square
         }
 
+        if (shouldStop()) {
+            return false;
+        }
+
         // Make move
-        board_.set(move.row, move.col, moveNumber);
-        path_.push_back(move);
+        makeMove(move);
 
         // Recursive call: try to solve from this new position
-        if (backtrack(move.row, move.col, moveNumber + 1)) {
+        if (backtrack(move, moveNumber + 1)) {
             return true;  // Solution found!
         }
+        if (wasStopped() || restartPending_) {
+            return false;  // Stopped: keep the partial path and the true backtrack count
+        }
 
         // Undo move (backtrack)
-        board_.set(move.row, move.col, 0);
-        path_.pop_back();
+        unmakeMove(move);
         ++backtrackCount_;
     }
 
@@ -89,74 +493,61 @@ bool Solver::isSolution(int moveNumber) const {
         return true;
     }
 
-    // For closed tour, verify we can return to starting position
+    // For closed tour, verify we can return to starting position: the cell
+    // offset from the final square to the start must be a knight move
     const auto& lastMove = path_.back();
-    auto validMoves = board_.getValidMoves(lastMove.row, lastMove.col, false);
-
-    // Check if starting position is reachable from final position
-    return std::any_of(validMoves.begin(), validMoves.end(),
-        [this](const Move& m) {
-            return m.row == startRow_ && m.col == startCol_;
-        });
+    const auto step = static_cast<ptrdiff_t>(board_.cellIndex(startRow_, startCol_)) -
+                      static_cast<ptrdiff_t>(board_.cellIndex(lastMove.row, lastMove.col));
+    const auto& offsets = board_.knightOffsets();
+    return std::find(offsets.begin(), offsets.end(), step) != offsets.end();
 }
 
-int Solver::calculateDegree(const Move& move) const {
-    return countAvailableMoves(move.row, move.col);
-}
+uint32_t Solver::moveKey(size_t cell) {
+    const auto degree = static_cast<uint32_t>(calculateDegree(cell));
+    if (tieBreak_ == TieBreak::SHUFFLE) {
+        return (degree << 24) | static_cast<uint32_t>(nextRandom() >> 40);
+    }
 
-int Solver::countAvailableMoves(int row, int col) const {
-    // Get all valid unvisited moves from this position
-    auto moves = board_.getValidMoves(row, col, true);
-    return static_cast<int>(moves.size());
-}
+    uint32_t tieBreak = 0;
+    uint32_t jitter = 0;
 
-void Solver::sortMoves(std::vector<Move>& moves) const {
-    // Helper function to calculate Manhattan distance from board center
-    auto distanceFromCenter = [this](const Move& move) {
-        int centerRow = static_cast<int>(board_.height()) / 2;
-        int centerCol = static_cast<int>(board_.width()) / 2;
-        return std::abs(move.row - centerRow) + std::abs(move.col - centerCol);
-    };
-
-    // Sort moves by degree (ascending order) with tie-breaking
-    // Warnsdorff's heuristic: choose squares with fewest onward moves first
-    // This visits "harder to reach" corners and edges early in the search
-    std::sort(moves.begin(), moves.end(),
-        [this, &distanceFromCenter](const Move& a, const Move& b) {
-            int degreeA = calculateDegree(a);
-            int degreeB = calculateDegree(b);
-
-            // Primary criterion: prefer lower degree (Warnsdorff's rule)
-            if (degreeA != degreeB) {
-                return degreeA < degreeB;
-            }
+    if (tieBreak_ != TieBreak::MOVE_ORDER) {
+        uint32_t distance = centerDistance_[cell];
+        tieBreak = tieBreak_ == TieBreak::CENTER_NEAR ? distance : 0xFFFFu - distance;
+    }
+    if (tieBreak_ == TieBreak::RANDOM) {
+        jitter = static_cast<uint32_t>(nextRandom() >> 56);
+    }
 
-            // Tie-breaker: when degrees are equal, prefer moves farther from center
-            // This prioritizes visiting edge/corner squares earlier
-            return distanceFromCenter(a) > distanceFromCenter(b);
-        });
+    return (degree << 24) | (tieBreak << 8) | jitter;
 }
 
-bool Solver::createsDeadEnd(const Move& move, int moveNumber) const {
-    // Temporarily make the move
-    board_.set(move.row, move.col, moveNumber);
-
-    // Check if any neighbor of this move would become isolated
-    bool hasDeadEnd = false;
-    auto neighbors = board_.getValidMoves(move.row, move.col, true);
+void Solver::sortMoves(StaticSquareList& moves) {
+    // Sort moves by key (degree ascending, then the tie-break policy)
+    uint32_t keys[8];
+    for (size_t i = 0; i < moves.size(); ++i) {
+        keys[i] = moveKey(moves[i]);
+    }
 
-    for (const auto& neighbor : neighbors) {
-        // If this neighbor would have no valid moves after our move, it's a dead end
-        if (countAvailableMoves(neighbor.row, neighbor.col) == 0) {
-            hasDeadEnd = true;
-            break;
+    // Insertion sort: at most 8 moves, and stable so equal keys keep KNIGHT_MOVES order
+    for (size_t i = 1; i < moves.size(); ++i) {
+        uint32_t key = keys[i];
+        uint32_t move = moves[i];
+        size_t j = i;
+        for (; j > 0 && keys[j - 1] > key; --j) {
+            keys[j] = keys[j - 1];
+            moves[j] = moves[j - 1];
         }
+        keys[j] = key;
+        moves[j] = move;
     }
+}
 
-    // Undo the temporary move
-    board_.set(move.row, move.col, 0);
-
-    return hasDeadEnd;
+bool Solver::createsDeadEnd(size_t cell) const {
+    // An unvisited neighbor whose only available move is this square would be
+    // left with degree 0 once the move is made. Visited and border cells
+    // never hold degree 1, so all 8 neighbors are tested at once.
+    return DegreeKernels::anyNeighborAtOne(degree_.data(), cell, board_.knightOffsets());
 }
 
 bool Solver::validatePath() const {
@@ -0,0 +1,74 @@
+#include "SolverPool.h"
+#include <algorithm>
+#include <memory>
+
+SolverPool::SolverPool(size_t threadCount, size_t queueCapacity)
+    : queue_(queueCapacity)
+    , submitted_(0)
+    , completed_(0)
+    , periodStartCompleted_(0)
+    , boardAllocations_(0)
+{
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workers_.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        workers_.emplace_back([this] { workerLoop(); });
+    }
+}
+
+SolverPool::~SolverPool() {
+    queue_.close();
+    workers_.clear();  // jthreads join here, after draining the queue
+}
+
+std::future<SolveResult> SolverPool::submit(const SolveJob& job) {
+    auto promise = std::make_shared<std::promise<SolveResult>>();
+    auto future = promise->get_future();
+    submit(job, [promise](SolveResult&& result) { promise->set_value(std::move(result)); });
+    return future;
+}
+
+void SolverPool::submit(const SolveJob& job, Callback callback) {
+    SolverWorkspace::validate(job);
+    {
+        std::lock_guard<std::mutex> lock(progressMutex_);
+        if (submitted_ == completed_.load()) {
+            // Idle pool: throughput is measured from here
+            periodStart_ = std::chrono::steady_clock::now();
+            periodStartCompleted_ = submitted_;
+        }
+        ++submitted_;
+    }
+    queue_.push(Task{job, std::move(callback)});
+}
+
+void SolverPool::wait() {
+    std::unique_lock<std::mutex> lock(progressMutex_);
+    progress_.wait(lock, [this] { return completed_.load() == submitted_; });
+}
+
+double SolverPool::getSolvesPerSecond() const {
+    std::lock_guard<std::mutex> lock(progressMutex_);
+    const double seconds = std::chrono::duration<double>(lastCompletion_ - periodStart_).count();
+    const size_t solves = completed_.load() - periodStartCompleted_;
+    return seconds > 0.0 ? static_cast<double>(solves) / seconds : 0.0;
+}
+
+void SolverPool::workerLoop() {
+    SolverWorkspace workspace;
+    while (auto task = queue_.pop()) {
+        const size_t allocatedBefore = workspace.getBoardAllocations();
+        SolveResult result = workspace.run(task->job);
+        boardAllocations_ += workspace.getBoardAllocations() - allocatedBefore;
+        task->callback(std::move(result));
+
+        std::lock_guard<std::mutex> lock(progressMutex_);
+        lastCompletion_ = std::chrono::steady_clock::now();
+        ++completed_;
+        if (completed_.load() == submitted_) {
+            progress_.notify_all();
+        }
+    }
+}
@@ -0,0 +1,95 @@
+#include "SolverWorkspace.h"
+#include "DivideAndConquerSolver.h"
+#include "FixedSolver.h"
+#include <chrono>
+#include <stdexcept>
+#include <string>
+
+SolverWorkspace::SolverWorkspace(size_t maxBoards)
+    : maxBoards_(maxBoards > 0 ? maxBoards : 1)
+    , boardAllocations_(0)
+    , lastStatus_(SolveStatus::UNSOLVABLE)
+{
+}
+
+void SolverWorkspace::validate(const SolveJob& job) {
+    // Board's size limit
+    constexpr size_t MAX_SIDE = 1000;
+    if (job.width < 1 || job.width > MAX_SIDE || job.height < 1 || job.height > MAX_SIDE) {
+        throw std::invalid_argument("board size must be between 1 and " + std::to_string(MAX_SIDE));
+    }
+    if (job.startRow < 0 || job.startRow >= static_cast<int>(job.height) ||
+        job.startCol < 0 || job.startCol >= static_cast<int>(job.width)) {
+        throw std::invalid_argument("start position out of bounds");
+    }
+    if (job.divide && !DivideAndConquerSolver::supports(job.width, job.height)) {
+        throw std::invalid_argument("divide-and-conquer needs an even-area board");
+    }
+    if (job.timeoutMillis < 0) {
+        throw std::invalid_argument("timeout must not be negative");
+    }
+}
+
+SolverWorkspace::Workspace& SolverWorkspace::workspaceFor(size_t width, size_t height) {
+    for (auto it = workspaces_.begin(); it != workspaces_.end(); ++it) {
+        if ((*it)->board.width() == width && (*it)->board.height() == height) {
+            workspaces_.splice(workspaces_.begin(), workspaces_, it);
+            return *workspaces_.front();
+        }
+    }
+
+    if (workspaces_.size() >= maxBoards_) {
+        workspaces_.pop_back();
+    }
+    workspaces_.push_front(std::make_unique<Workspace>(width, height));
+    ++boardAllocations_;
+    return *workspaces_.front();
+}
+
+bool SolverWorkspace::solve(const SolveJob& job) {
+    Workspace& workspace = workspaceFor(job.width, job.height);
+    Solver& solver = workspace.solver;
+
+    if (job.divide) {
+        DivideAndConquerSolver builder(workspace.board);
+        const bool solved = builder.solve(job.startRow, job.startCol, job.type) &&
+                            solver.setSolution(builder.getPath(), job.type);
+        lastStatus_ = solved ? SolveStatus::SOLVED : SolveStatus::UNSOLVABLE;
+        return solved;
+    }
+
+    SolveOptions options;
+    if (job.timeoutMillis > 0) {
+        options = SolveOptions::withTimeout(std::chrono::milliseconds(job.timeoutMillis));
+    }
+    options.maxBacktracks = job.maxBacktracks;
+    options.restartBacktracks = job.restartBacktracks;
+    options.stopToken = job.stopToken;
+    if (!options.isLimited() && options.restartBacktracks == 0) {
+        if (auto specialized = solveSpecialized(solver, job.width, job.height, job.startRow, job.startCol,
+                                                job.type)) {
+            lastStatus_ = *specialized ? SolveStatus::SOLVED : SolveStatus::UNSOLVABLE;
+            return *specialized;
+        }
+    }
+    lastStatus_ = solver.solve(job.startRow, job.startCol, job.type, options);
+    return lastStatus_ == SolveStatus::SOLVED;
+}
+
+SolveResult SolverWorkspace::run(const SolveJob& job) {
+    SolveResult result;
+    result.job = job;
+
+    auto start = std::chrono::steady_clock::now();
+    result.solved = solve(job);
+    result.status = lastStatus_;
+    result.micros = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+
+    const Solver& solver = lastSolver();
+    result.backtracks = solver.getBacktrackCount();
+    if (result.solved) {
+        result.path = solver.getPath();
+    }
+    return result;
+}
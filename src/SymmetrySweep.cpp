@@ -0,0 +1,99 @@
+#include "SymmetrySweep.h"
+
+SymmetrySweep::SymmetrySweep(size_t width, size_t height)
+    : width_(width)
+    , height_(height)
+{
+    if (width == 0 || height == 0) {
+        throw std::invalid_argument("Board dimensions must be positive");
+    }
+
+    const auto group = symmetries(width, height);
+    std::vector<bool> assigned(width * height, false);
+
+    // Scanning in row-major order makes each representative the first square of its orbit
+    for (size_t index = 0; index < assigned.size(); ++index) {
+        if (assigned[index]) {
+            continue;
+        }
+
+        StartOrbit orbit;
+        orbit.representative = {static_cast<int>(index / width), static_cast<int>(index % width)};
+        for (Symmetry symmetry : group) {
+            Move image = transform(symmetry, orbit.representative, width, height);
+            size_t imageIndex = static_cast<size_t>(image.row) * width + static_cast<size_t>(image.col);
+            if (assigned[imageIndex]) {
+                continue;  // Fixed by an earlier symmetry (square on an axis or diagonal)
+            }
+            assigned[imageIndex] = true;
+            orbit.squares.push_back(image);
+            orbit.transforms.push_back(symmetry);
+        }
+        orbits_.push_back(std::move(orbit));
+    }
+}
+
+std::vector<Symmetry> SymmetrySweep::symmetries(size_t width, size_t height) {
+    if (width == height) {
+        return {Symmetry::IDENTITY, Symmetry::ROTATE_90, Symmetry::ROTATE_180, Symmetry::ROTATE_270,
+                Symmetry::FLIP_HORIZONTAL, Symmetry::FLIP_VERTICAL, Symmetry::TRANSPOSE, Symmetry::ANTI_TRANSPOSE};
+    }
+    return {Symmetry::IDENTITY, Symmetry::ROTATE_180, Symmetry::FLIP_HORIZONTAL, Symmetry::FLIP_VERTICAL};
+}
+
+Move SymmetrySweep::transform(Symmetry symmetry, Move square, size_t width, size_t height) {
+    const int lastRow = static_cast<int>(height) - 1;
+    const int lastCol = static_cast<int>(width) - 1;
+    const int r = square.row;
+    const int c = square.col;
+
+    switch (symmetry) {
+        case Symmetry::IDENTITY:        return {r, c};
+        case Symmetry::ROTATE_90:       return {c, lastRow - r};
+        case Symmetry::ROTATE_180:      return {lastRow - r, lastCol - c};
+        case Symmetry::ROTATE_270:      return {lastCol - c, r};
+        case Symmetry::FLIP_HORIZONTAL: return {r, lastCol - c};
+        case Symmetry::FLIP_VERTICAL:   return {lastRow - r, c};
+        case Symmetry::TRANSPOSE:       return {c, r};
+        case Symmetry::ANTI_TRANSPOSE:  return {lastCol - c, lastRow - r};
+    }
+    return square;
+}
+
+std::vector<Move> SymmetrySweep::transformPath(Symmetry symmetry, const std::vector<Move>& path,
+                                               size_t width, size_t height) {
+    std::vector<Move> image;
+    image.reserve(path.size());
+    for (const Move& square : path) {
+        image.push_back(transform(symmetry, square, width, height));
+    }
+    return image;
+}
+
+size_t SymmetrySweep::run(Solver& solver, TourType type, const SweepCallback& callback) const {
+    size_t solvedCount = 0;
+    SweepResult result;
+
+    for (const auto& orbit : orbits_) {
+        bool solved = solver.solve(orbit.representative.row, orbit.representative.col, type);
+        const size_t backtracks = solver.getBacktrackCount();
+
+        for (size_t i = 0; i < orbit.squares.size(); ++i) {
+            result.start = orbit.squares[i];
+            result.solved = solved;
+            result.derived = i > 0;
+            result.backtracks = backtracks;
+            result.path.clear();
+            if (solved) {
+                for (const Move& square : solver.getPath()) {
+                    result.path.push_back(transform(orbit.transforms[i], square, width_, height_));
+                }
+            }
+            solvedCount += solved ? 1 : 0;
+            if (callback) {
+                callback(result);
+            }
+        }
+    }
+    return solvedCount;
+}
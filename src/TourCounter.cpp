@@ -0,0 +1,330 @@
+#include "TourCounter.h"
+#include "KnightGraph.h"
+#include "TourFeasibility.h"
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+
+namespace {
+
+// Frontier slot values: a square with no tour edges yet, a square with two
+// (finished), or (mate slot + 1) for an end of a path fragment
+constexpr uint8_t SLOT_EMPTY = 0;
+constexpr uint8_t SLOT_INTERIOR = 0xFF;
+
+// Slots: a window of 2 * short side + 2 squares, plus one for the apex
+constexpr size_t MAX_SLOTS = 2 * TourCounter::MAX_FRONTIER_SIDE + 3;
+
+using FrontierState = std::array<uint8_t, MAX_SLOTS>;
+
+struct FrontierHash {
+    size_t operator()(const FrontierState& state) const noexcept {
+        // FNV-1a
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for (uint8_t value : state) {
+            hash = (hash ^ value) * 0x100000001b3ULL;
+        }
+        return static_cast<size_t>(hash);
+    }
+};
+
+using StateCounts = std::unordered_map<FrontierState, uint64_t, FrontierHash>;
+
+uint64_t checkedAdd(uint64_t a, uint64_t b) {
+    if (a > UINT64_MAX - b) {
+        throw std::overflow_error("Tour count does not fit in 64 bits");
+    }
+    return a + b;
+}
+
+void addCount(StateCounts& states, const FrontierState& state, uint64_t count) {
+    auto& total = states[state];
+    total = checkedAdd(total, count);
+}
+
+/**
+ * @brief Add one edge between two live slots to every state that allows it
+ * @param finalSlots Live slots once every square has entered the frontier
+ *        (0 before that); a cycle is a tour only if it finishes all of them
+ * @param cycles Receives the counts of states the edge completes into a tour
+ */
+StateCounts applyEdge(const StateCounts& states, size_t a, size_t b, uint32_t finalSlots, uint64_t& cycles) {
+    StateCounts next;
+    next.reserve(states.size() * 2);
+
+    for (const auto& [state, count] : states) {
+        // Leave the edge out
+        addCount(next, state, count);
+
+        if (state[a] == SLOT_INTERIOR || state[b] == SLOT_INTERIOR) {
+            continue;
+        }
+
+        // Joining both ends of one fragment closes a cycle, which is only
+        // allowed as the final edge of a tour through every square
+        if (state[a] != SLOT_EMPTY && state[a] - 1u == b) {
+            if (finalSlots == 0) {
+                continue;
+            }
+            bool complete = true;
+            for (size_t slot = 0; slot < MAX_SLOTS && complete; ++slot) {
+                if ((finalSlots >> slot & 1u) && slot != a && slot != b) {
+                    complete = state[slot] == SLOT_INTERIOR;
+                }
+            }
+            if (complete) {
+                cycles = checkedAdd(cycles, count);
+            }
+            continue;
+        }
+
+        // Join two fragments: their outer ends become mates
+        const size_t endA = state[a] == SLOT_EMPTY ? a : state[a] - 1u;
+        const size_t endB = state[b] == SLOT_EMPTY ? b : state[b] - 1u;
+        FrontierState joined = state;
+        if (state[a] != SLOT_EMPTY) {
+            joined[a] = SLOT_INTERIOR;
+        }
+        if (state[b] != SLOT_EMPTY) {
+            joined[b] = SLOT_INTERIOR;
+        }
+        joined[endA] = static_cast<uint8_t>(endB + 1);
+        joined[endB] = static_cast<uint8_t>(endA + 1);
+        addCount(next, joined, count);
+    }
+    return next;
+}
+
+}  // namespace
+
+TourCounter::TourCounter(Board& board)
+    : board_(board)
+    , degree_(board.size(), 0)
+    , peakStates_(0)
+{
+}
+
+uint64_t TourCounter::enumerate(int startRow, int startCol, TourType type, const TourCallback& callback) {
+    if (!board_.isValid(startRow, startCol)) {
+        return 0;
+    }
+    if (!TourFeasibility::isPossible(board_.width(), board_.height(), startRow, startCol, type)) {
+        return 0;  // Proven: the exhaustive search would find nothing
+    }
+
+    const auto& graph = board_.graph();
+    const size_t squares = board_.size();
+    const auto start = static_cast<uint32_t>(graph.toIndex(startRow, startCol));
+
+    board_.clear();
+    for (size_t i = 0; i < squares; ++i) {
+        degree_[i] = static_cast<uint8_t>(graph.degree(i));
+    }
+
+    std::vector<Move> path;
+    std::vector<uint32_t> stack;      // Squares of the current path
+    std::vector<uint8_t> cursor;      // Next neighbor-list position to try at each depth
+    path.reserve(squares);
+    stack.reserve(squares);
+    cursor.reserve(squares);
+
+    auto visit = [&](uint32_t square) {
+        board_.setByIndex(square, static_cast<int>(stack.size()) + 1);
+        for (uint32_t neighbor : graph.neighbors(square)) {
+            --degree_[neighbor];
+        }
+        stack.push_back(square);
+        cursor.push_back(0);
+        path.push_back(graph.toMove(square));
+    };
+    auto leave = [&]() {
+        uint32_t square = stack.back();
+        board_.setByIndex(square, 0);
+        for (uint32_t neighbor : graph.neighbors(square)) {
+            ++degree_[neighbor];
+        }
+        stack.pop_back();
+        cursor.pop_back();
+        path.pop_back();
+    };
+    // Sound pruning only: no tour through the remaining squares can exist
+    auto hopeless = [&](uint32_t square) {
+        const size_t remaining = squares - stack.size();
+        if (remaining == 0) {
+            return false;
+        }
+        // A closed tour must end next to the start
+        if (type == TourType::CLOSED && degree_[start] == 0) {
+            return true;
+        }
+        // A neighbor with no other unvisited neighbor can only be the last square
+        for (uint32_t neighbor : graph.neighbors(square)) {
+            if (!board_.isVisitedIndex(neighbor) && degree_[neighbor] == 0 && remaining > 1) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    uint64_t found = 0;
+    bool stopped = false;
+    auto report = [&]() {
+        if (type == TourType::CLOSED) {
+            auto neighbors = graph.neighbors(stack.back());
+            if (std::find(neighbors.begin(), neighbors.end(), start) == neighbors.end()) {
+                return;
+            }
+        }
+        ++found;
+        if (callback && !callback(path)) {
+            stopped = true;
+        }
+    };
+
+    visit(start);
+    if (stack.size() == squares) {
+        report();
+    }
+
+    while (!stack.empty() && !stopped && stack.size() < squares) {
+        auto neighbors = graph.neighbors(stack.back());
+        uint8_t& next = cursor.back();
+        if (next == neighbors.size()) {
+            leave();
+            continue;
+        }
+
+        uint32_t square = neighbors[next++];
+        if (board_.isVisitedIndex(square)) {
+            continue;
+        }
+
+        visit(square);
+        if (stack.size() == squares) {
+            report();
+            leave();
+        } else if (hopeless(square)) {
+            leave();
+        }
+    }
+
+    board_.clear();
+    return found;
+}
+
+uint64_t TourCounter::count(TourType type) {
+    peakStates_ = 0;
+
+    // Process squares column by column along the long side
+    const size_t shortSide = std::min(board_.width(), board_.height());
+    const size_t longSide = std::max(board_.width(), board_.height());
+
+    // Boards without any tour need no states (e.g. closed tours on odd areas)
+    const bool anyTour = type == TourType::CLOSED ? TourFeasibility::hasClosedTour(board_.width(), board_.height())
+                                                  : TourFeasibility::hasOpenTour(board_.width(), board_.height());
+    if (!anyTour) {
+        return 0;
+    }
+    if (shortSide > MAX_FRONTIER_SIDE) {
+        throw std::invalid_argument("Board too wide for frontier counting (short side max " +
+                                    std::to_string(MAX_FRONTIER_SIDE) + ")");
+    }
+
+    const size_t squares = shortSide * longSide;
+    if (squares == 1) {
+        return type == TourType::OPEN ? 1 : 0;
+    }
+
+    // Vertex v = column * shortSide + row; knight neighbors differ by at most
+    // 2 * shortSide + 1, so a window of 2 * shortSide + 2 slots never collides
+    const size_t window = 2 * shortSide + 2;
+    const size_t apexSlot = window;   // Open tours: Hamiltonian cycles through an extra apex vertex
+    auto vertexAt = [&](int row, int col) -> long {
+        if (row < 0 || col < 0 || row >= static_cast<int>(shortSide) || col >= static_cast<int>(longSide)) {
+            return -1;
+        }
+        return static_cast<long>(col) * static_cast<long>(shortSide) + row;
+    };
+
+    // Earlier and later neighbors of each vertex
+    std::vector<std::vector<size_t>> lowerNeighbors(squares);
+    std::vector<std::vector<size_t>> upperNeighbors(squares);
+    for (size_t v = 0; v < squares; ++v) {
+        const int row = static_cast<int>(v % shortSide);
+        const int col = static_cast<int>(v / shortSide);
+        for (const auto& delta : Board::KNIGHT_MOVES) {
+            long u = vertexAt(row + delta.row, col + delta.col);
+            if (u < 0) {
+                continue;
+            }
+            auto& list = static_cast<size_t>(u) < v ? lowerNeighbors[v] : upperNeighbors[v];
+            list.push_back(static_cast<size_t>(u));
+        }
+    }
+    auto edgesLeft = [&](size_t u, size_t v) {
+        return static_cast<size_t>(std::count_if(upperNeighbors[u].begin(), upperNeighbors[u].end(),
+                                                 [v](size_t w) { return w > v; }));
+    };
+    auto degreeNeeded = [](uint8_t value) -> size_t {
+        return value == SLOT_EMPTY ? 2 : value == SLOT_INTERIOR ? 0 : 1;
+    };
+
+    StateCounts states;
+    states.emplace(FrontierState{}, 1);
+    uint64_t tours = 0;
+
+    for (size_t v = 0; v < squares; ++v) {
+        const size_t slot = v % window;
+        const size_t oldest = v + 1 >= window ? v + 1 - window : 0;
+
+        uint32_t finalSlots = 0;
+        if (v + 1 == squares) {
+            for (size_t u = oldest; u <= v; ++u) {
+                if (u == v || edgesLeft(u, v - 1) > 0) {
+                    finalSlots |= 1u << (u % window);
+                }
+            }
+            if (type == TourType::OPEN) {
+                finalSlots |= 1u << apexSlot;
+            }
+        }
+
+        for (size_t u : lowerNeighbors[v]) {
+            states = applyEdge(states, u % window, slot, finalSlots, tours);
+        }
+        if (type == TourType::OPEN) {
+            states = applyEdge(states, apexSlot, slot, finalSlots, tours);
+        }
+        peakStates_ = std::max(peakStates_, states.size());
+
+        // Drop states where a square can no longer reach degree 2 with the
+        // moves it has left; squares with no moves left leave the frontier
+        std::array<size_t, MAX_SLOTS> movesLeft{};
+        std::array<bool, MAX_SLOTS> live{};
+        for (size_t u = oldest; u <= v; ++u) {
+            movesLeft[u % window] = edgesLeft(u, v);
+            live[u % window] = u == v || edgesLeft(u, v - 1) > 0;
+        }
+        StateCounts pruned;
+        pruned.reserve(states.size());
+        for (const auto& [state, count] : states) {
+            FrontierState kept = state;
+            bool valid = type == TourType::CLOSED || degreeNeeded(state[apexSlot]) <= squares - 1 - v;
+            for (size_t u = oldest; u <= v && valid; ++u) {
+                const size_t uSlot = u % window;
+                if (!live[uSlot]) {
+                    continue;
+                }
+                valid = degreeNeeded(kept[uSlot]) <= movesLeft[uSlot];
+                if (movesLeft[uSlot] == 0) {
+                    kept[uSlot] = SLOT_EMPTY;
+                }
+            }
+            if (valid) {
+                addCount(pruned, kept, count);
+            }
+        }
+        states = std::move(pruned);
+    }
+    return tours;
+}
@@ -0,0 +1,58 @@
+#include "TourFeasibility.h"
+#include <algorithm>
+
+bool TourFeasibility::hasClosedTour(size_t width, size_t height) noexcept {
+    const size_t m = std::min(width, height);
+    const size_t n = std::max(width, height);
+
+    if (m % 2 == 1 && n % 2 == 1) {
+        return false;
+    }
+    if (m == 1 || m == 2 || m == 4) {
+        return false;
+    }
+    if (m == 3 && (n == 4 || n == 6 || n == 8)) {
+        return false;
+    }
+    return true;
+}
+
+bool TourFeasibility::hasOpenTour(size_t width, size_t height) noexcept {
+    const size_t m = std::min(width, height);
+    const size_t n = std::max(width, height);
+
+    switch (m) {
+        case 1:  return n == 1;
+        case 2:  return false;
+        case 3:  return n == 4 || n >= 7;
+        case 4:  return n >= 5;
+        default: return true;
+    }
+}
+
+const char* TourFeasibility::whyImpossible(size_t width, size_t height, int startRow, int startCol,
+                                           TourType type) noexcept {
+    if (type == TourType::CLOSED) {
+        if (width % 2 == 1 && height % 2 == 1) {
+            return "a closed tour needs an even number of squares";
+        }
+        if (!hasClosedTour(width, height)) {
+            return "no closed tour exists on this board size";
+        }
+        return nullptr;
+    }
+
+    if (!hasOpenTour(width, height)) {
+        return "no open tour exists on this board size";
+    }
+    if (width % 2 == 1 && height % 2 == 1 && (startRow + startCol) % 2 == 1) {
+        return "an open tour of an odd-area board must start on a corner-colored square";
+    }
+    if (std::min(width, height) == 4) {
+        const int line = width == 4 ? startCol : startRow;
+        if (line == 1 || line == 2) {
+            return "an open tour of a 4xn board must start on one of its two outer lines";
+        }
+    }
+    return nullptr;
+}
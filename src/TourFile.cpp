@@ -0,0 +1,141 @@
+#include "TourFile.h"
+#include "PathCodec.h"
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+static_assert(sizeof(TourFileHeader) == 56, "TourFileHeader must have no padding");
+static_assert(std::endian::native == std::endian::little, ".kt files are little-endian");
+
+namespace {
+
+constexpr size_t INDEX_ENTRY_SIZE = 2 * sizeof(int32_t);
+
+size_t blockCountFor(uint64_t moveCount, uint32_t blockSize) {
+    return static_cast<size_t>((moveCount + blockSize - 1) / blockSize);
+}
+
+}  // namespace
+
+uint64_t TourFile::checksum(const uint8_t* data, size_t size, uint64_t seed) noexcept {
+    uint64_t hash = seed;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ data[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+bool TourFile::encode(const std::vector<Move>& path, size_t width, size_t height, TourType type,
+                      uint64_t backtracks, uint32_t blockSize, std::vector<uint8_t>& out) {
+    if (path.empty() || blockSize == 0) {
+        return false;
+    }
+
+    std::vector<uint8_t> moves;
+    if (!PathCodec::encode(path, moves)) {
+        return false;
+    }
+
+    // Square at the start of every block
+    std::vector<uint8_t> index(blockCountFor(path.size(), blockSize) * INDEX_ENTRY_SIZE);
+    for (size_t b = 0; b * blockSize < path.size(); ++b) {
+        const int32_t square[2] = {path[b * blockSize].row, path[b * blockSize].col};
+        std::memcpy(index.data() + b * INDEX_ENTRY_SIZE, square, INDEX_ENTRY_SIZE);
+    }
+
+    TourFileHeader header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.width = static_cast<uint32_t>(width);
+    header.height = static_cast<uint32_t>(height);
+    header.startRow = path.front().row;
+    header.startCol = path.front().col;
+    header.tourType = type == TourType::CLOSED ? 1 : 0;
+    header.moveCount = path.size();
+    header.backtracks = backtracks;
+    header.blockSize = blockSize;
+    header.blockCount = static_cast<uint32_t>(index.size() / INDEX_ENTRY_SIZE);
+    header.checksum = checksum(moves.data(), moves.size(), checksum(index.data(), index.size()));
+
+    const auto* headerBytes = reinterpret_cast<const uint8_t*>(&header);
+    out.insert(out.end(), headerBytes, headerBytes + sizeof(header));
+    out.insert(out.end(), index.begin(), index.end());
+    out.insert(out.end(), moves.begin(), moves.end());
+    return true;
+}
+
+bool TourFile::write(const std::string& filename, const std::vector<Move>& path, size_t width, size_t height,
+                     TourType type, uint64_t backtracks, uint32_t blockSize) {
+    std::vector<uint8_t> bytes;
+    if (!encode(path, width, height, type, backtracks, blockSize, bytes)) {
+        return false;
+    }
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(file);
+}
+
+TourReader::TourReader(const std::string& filename)
+    : file_(filename)
+    , header_{}
+    , index_(nullptr)
+    , moves_(nullptr)
+    , movesSize_(0)
+{
+    if (file_.size() < sizeof(header_)) {
+        throw std::runtime_error(filename + ": not a tour file (too short)");
+    }
+    std::memcpy(&header_, file_.data(), sizeof(header_));
+    if (std::memcmp(header_.magic, TourFile::MAGIC, sizeof(TourFile::MAGIC)) != 0) {
+        throw std::runtime_error(filename + ": not a tour file (bad magic)");
+    }
+
+    const uint64_t squares = static_cast<uint64_t>(header_.width) * header_.height;
+    if (header_.moveCount == 0 || header_.moveCount > squares || header_.blockSize == 0 ||
+        header_.blockCount != blockCountFor(header_.moveCount, header_.blockSize) || header_.tourType > 1 ||
+        header_.startRow < 0 || static_cast<uint32_t>(header_.startRow) >= header_.height ||
+        header_.startCol < 0 || static_cast<uint32_t>(header_.startCol) >= header_.width) {
+        throw std::runtime_error(filename + ": corrupt tour file header");
+    }
+
+    const size_t indexSize = static_cast<size_t>(header_.blockCount) * INDEX_ENTRY_SIZE;
+    movesSize_ = PathCodec::encodedSize(static_cast<size_t>(header_.moveCount));
+    if (file_.size() != sizeof(header_) + indexSize + movesSize_) {
+        throw std::runtime_error(filename + ": tour file size does not match its header");
+    }
+    index_ = file_.data() + sizeof(header_);
+    moves_ = index_ + indexSize;
+}
+
+Move TourReader::move(size_t i) const {
+    if (i >= size()) {
+        throw std::out_of_range("Tour move index out of range");
+    }
+
+    const size_t block = i / header_.blockSize;
+    int32_t square[2];
+    std::memcpy(square, index_ + block * INDEX_ENTRY_SIZE, INDEX_ENTRY_SIZE);
+
+    Move current{square[0], square[1]};
+    for (size_t step = block * header_.blockSize; step < i; ++step) {
+        const Move& delta = Board::KNIGHT_MOVES[PathCodec::code(moves_, step)];
+        current.row += delta.row;
+        current.col += delta.col;
+    }
+    return current;
+}
+
+std::vector<Move> TourReader::readAll() const {
+    std::vector<Move> path;
+    PathCodec::decode(moves_, movesSize_, start(), size(), path);
+    return path;
+}
+
+bool TourReader::verify() const {
+    const size_t indexSize = static_cast<size_t>(header_.blockCount) * INDEX_ENTRY_SIZE;
+    return TourFile::checksum(moves_, movesSize_, TourFile::checksum(index_, indexSize)) == header_.checksum;
+}
@@ -1,12 +1,36 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <csignal>
 #include <iostream>
+#include <fstream>
 #include <iomanip>
 #include <chrono>
 #include <thread>
 #include <limits>
+#include <optional>
+#include <mutex>
+#include <stop_token>
 #include <cstring>
 #include <cstdlib>
+#include <filesystem>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include "Board.h"
 #include "Solver.h"
+#include "BatchRunner.h"
+#include "SolverPool.h"
+#include "SolveServer.h"
+#include "DivideAndConquerSolver.h"
+#include "FixedSolver.h"
+#include "ParallelSolver.h"
+#include "PortfolioSolver.h"
+#include "SolutionCache.h"
+#include "SymmetrySweep.h"
+#include "TourFeasibility.h"
+#include "TourCounter.h"
 #include "Exporter.h"
 
 constexpr const char* VERSION = "2.1.0";
@@ -16,10 +40,22 @@ struct CLIOptions {
     bool showVersion = false;
     bool quickSolve = false;
     bool closedTour = false;
+    bool countTours = false;
+    bool sweepStarts = false;
     int size = 8;
     int startRow = 0;
     int startCol = 0;
     std::string exportFormat = "";
+    std::string algorithm = "warnsdorff";
+    int threads = 0;            // Portfolio/parallel/batch threads (0 = hardware concurrency)
+    std::string cacheDir = "";  // On-disk solution cache (empty = none)
+    bool batch = false;
+    std::string batchFile = "";  // Job file for --batch (empty or "-" = stdin)
+    std::string servePath = "";  // Unix socket for --serve (empty = don't serve)
+    int64_t timeoutMillis = 0;   // Warnsdorff time limit per solve (0 = none)
+    size_t restartBacktracks = 0;  // Warnsdorff Luby restart unit (0 = never restart)
+    bool svgLevelOfDetail = false;
+    size_t svgLabelLimit = Exporter::DEFAULT_SVG_LABEL_LIMIT;
 };
 
 void printVersion() {
@@ -33,10 +69,33 @@ void printHelp() {
     std::cout << "  -h, --help          Show this help message\n";
     std::cout << "  -v, --version       Show version number\n";
     std::cout << "  -q, --quick         Quick solve and exit\n";
-    std::cout << "  -s, --size N        Board size (default: 8)\n";
+    std::cout << "  -s, --size N        Board size, 5-1000 (default: 8)\n";
     std::cout << "  -p, --start R,C     Starting position (default: 0,0)\n";
     std::cout << "  -c, --closed        Find closed tour\n";
-    std::cout << "  -e, --export FMT    Export result (json|svg|txt)\n\n";
+    std::cout << "  -e, --export FMT    Export result (json|svg|txt|kt|png)\n";
+    std::cout << "  --lod               Level-of-detail SVG: pattern board, one path element\n";
+    std::cout << "  --labels N          With --lod, label moves only on boards of at most N squares\n";
+    std::cout << "                      (default: " << Exporter::DEFAULT_SVG_LABEL_LIMIT << ")\n";
+    std::cout << "  -a, --algo NAME     Algorithm: warnsdorff (default), divide\n";
+    std::cout << "                      (divide-and-conquer, even-area boards only)\n";
+    std::cout << "                      portfolio (race tie-break strategies)\n";
+    std::cout << "                      or parallel (split the search tree)\n";
+    std::cout << "  -t, --threads N     Portfolio/parallel/batch threads (default: all cores)\n";
+    std::cout << "  --cache DIR         Reuse Warnsdorff tours stored in DIR (and store new ones)\n";
+    std::cout << "  --batch [FILE]      Solve one job per line from FILE or stdin, streaming results\n";
+    std::cout << "                      to stdout as NDJSON (or .kt records with -e kt). Job fields:\n";
+    std::cout << "                      size= width= height= start=R,C type=open|closed\n";
+    std::cout << "                      format=json|kt algo=warnsdorff|divide id=\n";
+    std::cout << "                      timeout=MS budget=BACKTRACKS restart=BACKTRACKS\n";
+    std::cout << "  --serve PATH        Answer length-prefixed binary or JSON solve requests on a\n";
+    std::cout << "                      Unix socket until interrupted (Linux)\n";
+    std::cout << "  --timeout MS        Give up a Warnsdorff, portfolio or parallel solve after MS\n";
+    std::cout << "                      milliseconds (also the default for --batch and --serve jobs)\n";
+    std::cout << "  --restart N         Restart a Warnsdorff solve with shuffled tie-breaks after\n";
+    std::cout << "                      N, N, 2N, N, N, 2N, 4N, ... backtracks (Luby sequence)\n";
+    std::cout << "  --count             Count all tours on a small board (up to 6; open 6x6 takes\n";
+    std::cout << "                      about 2 minutes)\n";
+    std::cout << "  --sweep             Solve from every start (one solve per symmetry orbit)\n\n";
     std::cout << "Examples:\n";
     std::cout << "  knights_tour                     Start interactive menu\n";
     std::cout << "  knights_tour -q                  Quick 8x8 solve\n";
@@ -44,6 +103,14 @@ void printHelp() {
     std::cout << "  knights_tour -q -s 8 -p 3,4      Solve from position (3,4)\n";
     std::cout << "  knights_tour -q -c               Find closed tour\n";
     std::cout << "  knights_tour -q -e svg           Solve and export to SVG\n";
+    std::cout << "  knights_tour -q -s 1000 -a divide -e svg --lod  Compact SVG of a large tour\n";
+    std::cout << "  knights_tour -q -a divide        Divide-and-conquer tour\n";
+    std::cout << "  knights_tour -q -c -a portfolio  Race strategies for a closed tour\n";
+    std::cout << "  knights_tour --count -s 6 -c     Count closed tours on 6x6\n";
+    std::cout << "  knights_tour --sweep -s 50       Check every start on 50x50\n";
+    std::cout << "  knights_tour --batch jobs.txt > results.ndjson  Solve every job in jobs.txt\n";
+    std::cout << "  knights_tour --serve /tmp/kt.sock -t 4  Serve solves to local clients\n";
+    std::cout << "  knights_tour -q -s 500 --cache tours  Solve once, replay on later runs\n";
 }
 
 void clearInput() {
@@ -101,15 +168,16 @@ void animateSolution(const Board& board, const std::vector<Move>& path) {
     std::cout << "\n✓ Tour complete!\n";
 }
 
-void quickSolve() {
+void quickSolve(SolutionCache& cache) {
     std::cout << "\n=== Quick Solve (8×8 Board) ===\n\n";
     Board board(8, 8);
     Solver solver(board);
     
     std::cout << "Solving from position (0, 0)...\n";
     
+    bool cached = false;
     auto start = std::chrono::high_resolution_clock::now();
-    bool solved = solver.solve(0, 0, TourType::OPEN);
+    bool solved = cache.solve(solver, board.width(), board.height(), 0, 0, TourType::OPEN, &cached);
     auto end = std::chrono::high_resolution_clock::now();
     
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
@@ -117,7 +185,7 @@ void quickSolve() {
     if (solved) {
         std::cout << "✓ Solution found!\n";
         std::cout << "  Time: " << duration.count() << " μs ("
-                  << (duration.count() / 1000.0) << " ms)\n";
+                  << (duration.count() / 1000.0) << " ms)" << (cached ? " [cached]" : "") << "\n";
         std::cout << "  Backtracks: " << solver.getBacktrackCount() << "\n";
         std::cout << "  Moves: " << solver.getPath().size() << "\n\n";
         
@@ -127,7 +195,7 @@ void quickSolve() {
     }
 }
 
-void solveCustom() {
+void solveCustom(SolutionCache& cache) {
     int width, height, startRow, startCol;
     char tourTypeChoice;
     
@@ -167,15 +235,16 @@ void solveCustom() {
     Board board(width, height);
     Solver solver(board);
     
+    bool cached = false;
     auto start = std::chrono::high_resolution_clock::now();
-    bool solved = solver.solve(startRow, startCol, type);
+    bool solved = cache.solve(solver, board.width(), board.height(), startRow, startCol, type, &cached);
     auto end = std::chrono::high_resolution_clock::now();
     
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
     
     if (solved) {
         std::cout << "✓ Solution found!\n";
-        std::cout << "  Time: " << duration.count() << " μs\n";
+        std::cout << "  Time: " << duration.count() << " μs" << (cached ? " [cached]" : "") << "\n";
         std::cout << "  Backtracks: " << solver.getBacktrackCount() << "\n\n";
         
         board.print();
@@ -290,24 +359,280 @@ void exportSolution() {
     clearInput();
 }
 
+int runCount(const CLIOptions& opts) {
+    Board board(opts.size, opts.size);
+    TourCounter counter(board);
+    TourType tourType = opts.closedTour ? TourType::CLOSED : TourType::OPEN;
+
+    std::cout << "Counting " << (opts.closedTour ? "closed" : "open") << " tours on "
+              << opts.size << "x" << opts.size << " board...\n";
+
+    try {
+        auto start = std::chrono::high_resolution_clock::now();
+        uint64_t tours = counter.count(tourType);
+        auto end = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+        std::cout << tours << " tours (a tour and its reverse counted once) in "
+                  << duration.count() << " ms\n";
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+int runSweep(const CLIOptions& opts) {
+    Board board(opts.size, opts.size);
+    Solver solver(board);
+    TourType tourType = opts.closedTour ? TourType::CLOSED : TourType::OPEN;
+    SymmetrySweep sweep(board.width(), board.height());
+
+    std::cout << "Sweeping all " << board.size() << " starts on " << opts.size << "x" << opts.size
+              << " board (" << sweep.orbits().size() << " symmetry orbits)";
+    if (opts.closedTour) std::cout << " [closed tour]";
+    std::cout << "...\n";
+
+    Board checkBoard(board.width(), board.height());
+    Solver checker(checkBoard);
+    size_t invalid = 0;
+    std::vector<Move> failed;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    size_t solved = sweep.run(solver, tourType, [&](const SweepResult& result) {
+        if (!result.solved) {
+            failed.push_back(result.start);
+        } else if (result.derived && !checker.setSolution(result.path, tourType)) {
+            ++invalid;
+        }
+    });
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+    std::cout << "Solved " << solved << "/" << board.size() << " starts with "
+              << sweep.orbits().size() << " solves in " << duration.count() << " ms\n";
+    if (!failed.empty()) {
+        std::cout << "No tour from:";
+        for (const auto& square : failed) {
+            std::cout << " (" << square.row << "," << square.col << ")";
+        }
+        std::cout << "\n";
+    }
+    if (invalid > 0) {
+        std::cerr << "Error: " << invalid << " derived tours are invalid\n";
+        return 1;
+    }
+    return 0;
+}
+
+// Whether a batch producer may wait for answers before writing more jobs
+// (a pipe, terminal or socket); a regular file never does
+bool isInteractiveInput(const std::string& path) {
+    if (!path.empty() && path != "-") {
+        return !std::filesystem::is_regular_file(path);
+    }
+#if defined(__unix__) || defined(__APPLE__)
+    struct stat info {};
+    return ::fstat(STDIN_FILENO, &info) != 0 || !S_ISREG(info.st_mode);
+#else
+    return true;
+#endif
+}
+
+int runBatch(const CLIOptions& opts) {
+    BatchFormat format = BatchFormat::JSON;
+    if (opts.exportFormat == "kt") {
+        format = BatchFormat::BINARY;
+    } else if (!opts.exportFormat.empty() && opts.exportFormat != "json") {
+        std::cerr << "Error: --batch writes json or kt, not " << opts.exportFormat << "\n";
+        return 1;
+    }
+
+    // Batch I/O goes through the iostream buffers only
+    std::ios::sync_with_stdio(false);
+
+    std::ifstream file;
+    if (!opts.batchFile.empty() && opts.batchFile != "-") {
+        file.open(opts.batchFile);
+        if (!file) {
+            std::cerr << "Error: Cannot open " << opts.batchFile << "\n";
+            return 1;
+        }
+    }
+    std::istream& in = file.is_open() ? static_cast<std::istream&>(file) : std::cin;
+
+    size_t threads = opts.threads > 0 ? static_cast<size_t>(opts.threads)
+                                      : std::max(1u, std::thread::hardware_concurrency());
+    BatchRunner runner(format, threads);
+    runner.setDefaultTimeout(opts.timeoutMillis);
+    runner.setInteractive(isInteractiveInput(opts.batchFile));
+    auto start = std::chrono::high_resolution_clock::now();
+    size_t rejected = runner.run(in, std::cout, std::cerr);
+    auto end = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    std::cerr << "Batch: " << runner.getJobCount() << " jobs, " << runner.getSolvedCount() << " solved, "
+              << rejected << " rejected, " << runner.getThreadCount() << " threads, "
+              << runner.getBoardAllocations() << " boards allocated, "
+              << std::fixed << std::setprecision(0)
+              << (seconds > 0.0 ? static_cast<double>(runner.getJobCount()) / seconds : 0.0) << " jobs/s\n";
+    return rejected == 0 ? 0 : 1;
+}
+
+// Server that SIGINT/SIGTERM stop (stop() only writes to an eventfd)
+std::atomic<SolveServer*> activeServer{nullptr};
+
+void stopActiveServer(int) {
+    if (SolveServer* server = activeServer.load()) {
+        server->stop();
+    }
+}
+
+int runServe(const CLIOptions& opts) {
+    size_t threads = opts.threads > 0 ? static_cast<size_t>(opts.threads)
+                                      : std::max(1u, std::thread::hardware_concurrency());
+    try {
+        SolveServer server(opts.servePath, threads);
+        server.setDefaultTimeout(opts.timeoutMillis);
+        activeServer.store(&server);
+        std::signal(SIGINT, stopActiveServer);
+        std::signal(SIGTERM, stopActiveServer);
+
+        std::cerr << "Serving on " << opts.servePath << " with " << server.getThreadCount()
+                  << " solver threads (Ctrl-C to stop)\n";
+        server.run();
+
+        std::signal(SIGINT, SIG_DFL);
+        std::signal(SIGTERM, SIG_DFL);
+        activeServer.store(nullptr);
+        std::cerr << "Served " << server.getRequestCount() << " requests on "
+                  << server.getConnectionCount() << " connections\n";
+    } catch (const std::exception& e) {
+        activeServer.store(nullptr);
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+// Requests stop on a source once a time limit has passed, unless destroyed first
+class StopTimer {
+public:
+    StopTimer(std::stop_source& source, int64_t millis)
+        : thread_([&source, millis](std::stop_token cancelled) {
+              std::mutex mutex;
+              std::condition_variable_any wake;
+              std::unique_lock lock(mutex);
+              wake.wait_for(lock, cancelled, std::chrono::milliseconds(millis), [] { return false; });
+              if (!cancelled.stop_requested()) {
+                  source.request_stop();
+              }
+          })
+    {
+    }
+
+private:
+    std::jthread thread_;  // Destructor cancels the wait and joins
+};
+
 int runCLI(const CLIOptions& opts) {
     Board board(opts.size, opts.size);
     Solver solver(board);
     TourType tourType = opts.closedTour ? TourType::CLOSED : TourType::OPEN;
 
+    if (opts.algorithm == "divide" && !DivideAndConquerSolver::supports(board.width(), board.height())) {
+        std::cerr << "Error: divide-and-conquer needs an even-area board\n";
+        return 1;
+    }
+    if (opts.algorithm == "divide" && (opts.timeoutMillis > 0 || opts.restartBacktracks > 0)) {
+        std::cerr << "Error: --timeout and --restart do not apply to divide-and-conquer (it never searches)\n";
+        return 1;
+    }
+    if (opts.restartBacktracks > 0 && opts.algorithm != "warnsdorff") {
+        std::cerr << "Error: --restart applies to the warnsdorff algorithm only\n";
+        return 1;
+    }
+
+    // FixedSolver has no time limit or restarts, so limited solves use Solver
+    SolveOptions options;
+    if (opts.timeoutMillis > 0) {
+        options = SolveOptions::withTimeout(std::chrono::milliseconds(opts.timeoutMillis));
+    }
+    options.restartBacktracks = opts.restartBacktracks;
+    const bool limited = options.isLimited() || options.restartBacktracks > 0;
+
     std::cout << "Solving " << opts.size << "x" << opts.size << " board from ("
               << opts.startRow << "," << opts.startCol << ")";
     if (opts.closedTour) std::cout << " [closed tour]";
     std::cout << "...\n";
 
     auto start = std::chrono::high_resolution_clock::now();
-    bool solved = solver.solve(opts.startRow, opts.startCol, tourType);
+    bool solved = false;
+    bool cached = false;
+    bool timedOut = false;
+    size_t backtracks = 0;  // Of the solve that timed out
+    if (opts.algorithm == "divide") {
+        DivideAndConquerSolver builder(board);
+        solved = builder.solve(opts.startRow, opts.startCol, tourType) &&
+                 solver.setSolution(builder.getPath(), tourType);
+    } else if (opts.algorithm == "portfolio") {
+        PortfolioSolver portfolio(board, static_cast<size_t>(opts.threads));
+        std::stop_source timeout;
+        portfolio.setStopToken(timeout.get_token());
+        {
+            std::optional<StopTimer> timer;
+            if (opts.timeoutMillis > 0) {
+                timer.emplace(timeout, opts.timeoutMillis);
+            }
+            solved = portfolio.solve(opts.startRow, opts.startCol, tourType) &&
+                     solver.setSolution(portfolio.getPath(), tourType, portfolio.getBacktrackCount());
+        }
+        timedOut = !solved && timeout.stop_requested();
+        backtracks = portfolio.getBacktrackCount();
+    } else if (opts.algorithm == "parallel") {
+        ParallelSolver parallel(board, static_cast<size_t>(opts.threads));
+        std::stop_source timeout;
+        parallel.setStopToken(timeout.get_token());
+        {
+            std::optional<StopTimer> timer;
+            if (opts.timeoutMillis > 0) {
+                timer.emplace(timeout, opts.timeoutMillis);
+            }
+            solved = parallel.solve(opts.startRow, opts.startCol, tourType) &&
+                     solver.setSolution(parallel.getPath(), tourType, parallel.getBacktrackCount());
+        }
+        timedOut = !solved && timeout.stop_requested();
+        backtracks = parallel.getBacktrackCount();
+    } else if (!opts.cacheDir.empty()) {
+        SolutionCache cache(SolutionCache::DEFAULT_CAPACITY, opts.cacheDir);
+        solved = cache.solve(solver, board.width(), board.height(), opts.startRow, opts.startCol, tourType, &cached,
+                             options);
+    } else if (limited) {
+        solved = solver.solve(opts.startRow, opts.startCol, tourType, options) == SolveStatus::SOLVED;
+    } else if (auto specialized = solveSpecialized(solver, board.width(), board.height(),
+                                                   opts.startRow, opts.startCol, tourType)) {
+        solved = *specialized;
+    } else {
+        solved = solver.solve(opts.startRow, opts.startCol, tourType);
+    }
     auto end = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    if (solver.getStatus() == SolveStatus::TIMED_OUT) {
+        timedOut = true;
+        backtracks = solver.getBacktrackCount();
+    }
 
     if (solved) {
-        std::cout << "Solution found in " << duration.count() << " us\n\n";
-        board.print();
+        std::cout << "Solution found in " << duration.count() << " us" << (cached ? " (cached)" : "");
+        if (solver.getRestartCount() > 0) {
+            std::cout << " after " << solver.getRestartCount() << " restarts";
+        }
+        std::cout << "\n\n";
+        if (opts.size > 100) {
+            board.printCompact();
+        } else {
+            board.print();
+        }
 
         if (!opts.exportFormat.empty()) {
             std::string filename = "knight_tour_solution." + opts.exportFormat;
@@ -315,10 +640,16 @@ int runCLI(const CLIOptions& opts) {
 
             if (opts.exportFormat == "json") {
                 success = Exporter::exportToJSON(solver, board, filename);
+            } else if (opts.exportFormat == "svg" && opts.svgLevelOfDetail) {
+                success = Exporter::exportToSVGLevelOfDetail(solver, board, filename, opts.svgLabelLimit);
             } else if (opts.exportFormat == "svg") {
                 success = Exporter::exportToSVG(solver, board, filename);
             } else if (opts.exportFormat == "txt") {
                 success = Exporter::exportToText(solver, board, filename);
+            } else if (opts.exportFormat == "kt") {
+                success = Exporter::exportToBinary(solver, board, filename);
+            } else if (opts.exportFormat == "png") {
+                success = Exporter::exportToPNG(solver, board, filename);
             } else {
                 std::cerr << "Unknown export format: " << opts.exportFormat << "\n";
                 return 1;
@@ -332,6 +663,13 @@ int runCLI(const CLIOptions& opts) {
             }
         }
         return 0;
+    } else if (timedOut) {
+        std::cout << "Gave up after " << opts.timeoutMillis << " ms (" << backtracks << " backtracks)\n";
+        return 1;
+    } else if (const char* reason = TourFeasibility::whyImpossible(board.width(), board.height(), opts.startRow,
+                                                                   opts.startCol, tourType)) {
+        std::cout << "No solution: " << reason << "\n";
+        return 1;
     } else {
         std::cout << "No solution found\n";
         return 1;
@@ -350,30 +688,32 @@ void testAllPositions() {
     Move fastestStart = {0, 0};
     Move slowestStart = {0, 0};
     
+    // One reusable board and solver per core
+    SolverPool pool;
+    std::vector<std::future<SolveResult>> results;
     for (int row = 0; row < 8; ++row) {
         for (int col = 0; col < 8; ++col) {
-            Board testBoard(8, 8);
-            Solver testSolver(testBoard);
-            
-            auto startTime = std::chrono::high_resolution_clock::now();
-            bool solved = testSolver.solve(row, col, TourType::OPEN);
-            auto endTime = std::chrono::high_resolution_clock::now();
-            
-            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count();
+            SolveJob job;
+            job.startRow = row;
+            job.startCol = col;
+            results.push_back(pool.submit(job));
+        }
+    }
+    
+    for (auto& future : results) {
+        SolveResult result = future.get();
+        if (result.solved) {
+            ++successCount;
+            totalTime += result.micros;
+            totalBacktracks += result.backtracks;
             
-            if (solved) {
-                ++successCount;
-                totalTime += elapsed;
-                totalBacktracks += testSolver.getBacktrackCount();
-                
-                if (elapsed < minTime) {
-                    minTime = elapsed;
-                    fastestStart = {row, col};
-                }
-                if (elapsed > maxTime) {
-                    maxTime = elapsed;
-                    slowestStart = {row, col};
-                }
+            if (result.micros < minTime) {
+                minTime = result.micros;
+                fastestStart = {result.job.startRow, result.job.startCol};
+            }
+            if (result.micros > maxTime) {
+                maxTime = result.micros;
+                slowestStart = {result.job.startRow, result.job.startCol};
             }
         }
     }
@@ -387,6 +727,8 @@ void testAllPositions() {
     std::cout << "  Max time: " << maxTime << " μs at position ("
               << slowestStart.row << "," << slowestStart.col << ")\n";
     std::cout << "  Avg backtracks: " << (totalBacktracks / successCount) << "\n";
+    std::cout << "  Throughput: " << static_cast<long long>(pool.getSolvesPerSecond()) << " solves/s on "
+              << pool.getThreadCount() << " thread" << (pool.getThreadCount() == 1 ? "" : "s") << "\n";
 }
 
 int main(int argc, char* argv[]) {
@@ -412,10 +754,29 @@ int main(int argc, char* argv[]) {
             opts.closedTour = true;
             continue;
         }
+        if (arg == "--count") {
+            opts.countTours = true;
+            continue;
+        }
+        if (arg == "--sweep") {
+            opts.sweepStarts = true;
+            continue;
+        }
+        if (arg == "--serve" && i + 1 < argc) {
+            opts.servePath = argv[++i];
+            continue;
+        }
+        if (arg == "--batch") {
+            opts.batch = true;
+            if (i + 1 < argc && (argv[i + 1][0] != '-' || std::string(argv[i + 1]) == "-")) {
+                opts.batchFile = argv[++i];
+            }
+            continue;
+        }
         if ((arg == "-s" || arg == "--size") && i + 1 < argc) {
             opts.size = std::atoi(argv[++i]);
-            if (opts.size < 5 || opts.size > 100) {
-                std::cerr << "Error: Size must be between 5 and 100\n";
+            if (opts.size < 5 || opts.size > 1000) {
+                std::cerr << "Error: Size must be between 5 and 1000\n";
                 return 1;
             }
             continue;
@@ -435,6 +796,59 @@ int main(int argc, char* argv[]) {
             opts.exportFormat = argv[++i];
             continue;
         }
+        if ((arg == "-a" || arg == "--algo") && i + 1 < argc) {
+            opts.algorithm = argv[++i];
+            if (opts.algorithm != "warnsdorff" && opts.algorithm != "divide" &&
+                opts.algorithm != "portfolio" && opts.algorithm != "parallel") {
+                std::cerr << "Error: Unknown algorithm '" << opts.algorithm
+                          << "' (use warnsdorff, divide, portfolio or parallel)\n";
+                return 1;
+            }
+            continue;
+        }
+        if (arg == "--lod") {
+            opts.svgLevelOfDetail = true;
+            continue;
+        }
+        if (arg == "--labels" && i + 1 < argc) {
+            int limit = std::atoi(argv[++i]);
+            if (limit < 0) {
+                std::cerr << "Error: Label limit must not be negative\n";
+                return 1;
+            }
+            opts.svgLabelLimit = static_cast<size_t>(limit);
+            opts.svgLevelOfDetail = true;
+            continue;
+        }
+        if (arg == "--timeout" && i + 1 < argc) {
+            opts.timeoutMillis = std::atoll(argv[++i]);
+            if (opts.timeoutMillis < 1) {
+                std::cerr << "Error: Timeout must be at least 1 ms\n";
+                return 1;
+            }
+            continue;
+        }
+        if (arg == "--restart" && i + 1 < argc) {
+            const long long unit = std::atoll(argv[++i]);
+            if (unit < 1) {
+                std::cerr << "Error: Restart interval must be at least 1 backtrack\n";
+                return 1;
+            }
+            opts.restartBacktracks = static_cast<size_t>(unit);
+            continue;
+        }
+        if (arg == "--cache" && i + 1 < argc) {
+            opts.cacheDir = argv[++i];
+            continue;
+        }
+        if ((arg == "-t" || arg == "--threads") && i + 1 < argc) {
+            opts.threads = std::atoi(argv[++i]);
+            if (opts.threads < 1 || opts.threads > 256) {
+                std::cerr << "Error: Threads must be between 1 and 256\n";
+                return 1;
+            }
+            continue;
+        }
 
         std::cerr << "Unknown option: " << arg << "\n";
         std::cerr << "Use --help for usage information\n";
@@ -448,6 +862,19 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
+    if (!opts.servePath.empty()) {
+        return runServe(opts);
+    }
+    if (opts.batch) {
+        return runBatch(opts);
+    }
+    if (opts.countTours) {
+        return runCount(opts);
+    }
+    if (opts.sweepStarts) {
+        return runSweep(opts);
+    }
+
     // Run in CLI mode if --quick was specified
     if (opts.quickSolve) {
         return runCLI(opts);
@@ -455,6 +882,9 @@ int main(int argc, char* argv[]) {
 
     std::cout << "\033[2J\033[H"; // Clear screen
 
+    // Repeated menu solves of the same board are replayed from memory
+    SolutionCache cache(SolutionCache::DEFAULT_CAPACITY, opts.cacheDir);
+
     try {
         int choice = -1;
         
@@ -472,7 +902,7 @@ int main(int argc, char* argv[]) {
             
             switch (choice) {
                 case 1:
-                    solveCustom();
+                    solveCustom(cache);
                     break;
                 case 2:
                     visualizeExisting();
@@ -484,7 +914,7 @@ int main(int argc, char* argv[]) {
                     testAllPositions();
                     break;
                 case 5:
-                    quickSolve();
+                    quickSolve(cache);
                     break;
                 case 0:
                     std::cout << "\nThank you for using Knight's Tour Solver!\n\n";